@@ -0,0 +1,33 @@
+#include "Animation.h"
+
+#include <algorithm>
+
+namespace animation {
+    size_t AdvanceFrames(float* __restrict elapsed, const float* __restrict frameDuration,
+                         i32* __restrict frame, const i32* __restrict frameCount,
+                         const u8* __restrict loop, size_t count, float deltaTime, u8* __restrict changed) {
+        for (size_t i = 0; i < count; ++i) {
+            // Everything here is non-negative, so truncation is floor and stays in vector registers
+            const float time = elapsed[i] + deltaTime;
+            const i32 steps = static_cast<i32>(time / frameDuration[i]);
+            elapsed[i] = time - static_cast<float>(steps) * frameDuration[i];
+
+            const i32 frames = frameCount[i];
+            const i32 next = frame[i] + steps;
+            const i32 wrapped = next - frames * static_cast<i32>(static_cast<float>(next) / static_cast<float>(frames));
+            // Float division can be off by one at exact multiples, fold that back in range
+            const i32 looped = wrapped + frames * static_cast<i32>(wrapped < 0) - frames * static_cast<i32>(wrapped >= frames);
+            const i32 held = std::min(next, frames - 1);
+            const i32 result = held + (looped - held) * static_cast<i32>(loop[i] != 0);
+
+            changed[i] = static_cast<u8>(result != frame[i]);
+            frame[i] = result;
+        }
+
+        size_t changedCount = 0;
+        for (size_t i = 0; i < count; ++i) {
+            changedCount += changed[i];
+        }
+        return changedCount;
+    }
+}
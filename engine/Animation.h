@@ -0,0 +1,18 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <cstddef>
+
+#include "Defines.h"
+
+namespace animation {
+    // Advances SoA flip-book clocks by deltaTime. Each entry steps `frame` by the whole frame
+    // durations in `elapsed`, wrapping when `loop` is set and holding the last frame otherwise.
+    // Expects frameDuration > 0 and frameCount >= 1; leave paused entries out. Writes 1/0 per
+    // entry into `changed` and returns how many changed frame. Branch-free so the compiler can
+    // vectorize it.
+    DLLEX size_t AdvanceFrames(float* elapsed, const float* frameDuration, i32* frame, const i32* frameCount,
+                               const u8* loop, size_t count, float deltaTime, u8* changed);
+}
+
+#endif //ANIMATION_H
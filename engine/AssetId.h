@@ -0,0 +1,132 @@
+#ifndef ASSETID_H
+#define ASSETID_H
+
+#include <bit>
+#include <string_view>
+#include <vector>
+
+#include "Defines.h"
+
+// 64-bit FNV-1a hash of an asset name. Constant ids are hashed at compile time:
+//     static constexpr AssetId PLAYER{"player"};
+struct AssetId {
+    u64 value = 0;
+
+    constexpr AssetId() = default;
+    constexpr explicit AssetId(std::string_view name) : value{Hash(name)} {}
+
+    static constexpr u64 Hash(std::string_view name) {
+        u64 hash = 0xcbf29ce484222325ULL;
+        for (const char c : name) {
+            hash ^= static_cast<u8>(c);
+            hash *= 0x100000001b3ULL;
+        }
+        // Zero marks an empty slot in AssetIdMap
+        return hash != 0 ? hash : 1;
+    }
+
+    constexpr bool operator==(const AssetId&) const = default;
+};
+
+// Open-addressing map from AssetId to a small value (usually a pointer into stable storage).
+// Linear probing with backward-shift deletion, so a hit is normally a single probe and
+// lookups never allocate. Not thread-safe; writers must not overlap readers.
+template<typename Value>
+class AssetIdMap {
+public:
+    Value* Find(AssetId id) {
+        if (slots.empty()) return nullptr;
+        for (size_t index = SlotOf(id.value); ; index = (index + 1) & mask) {
+            Slot& slot = slots[index];
+            if (slot.key == id.value) return &slot.value;
+            if (slot.key == 0) return nullptr;
+        }
+    }
+
+    const Value* Find(AssetId id) const {
+        return const_cast<AssetIdMap*>(this)->Find(id);
+    }
+
+    // Inserts or replaces the value stored for id
+    void Insert(AssetId id, Value value) {
+        if ((count + 1) * 2 > slots.size()) Grow();
+        InsertKey(id.value, value);
+    }
+
+    bool Erase(AssetId id) {
+        if (slots.empty()) return false;
+
+        size_t hole = SlotOf(id.value);
+        while (slots[hole].key != id.value) {
+            if (slots[hole].key == 0) return false;
+            hole = (hole + 1) & mask;
+        }
+
+        // Pull later members of the probe chain back so no tombstones are needed
+        for (size_t index = (hole + 1) & mask; slots[index].key != 0; index = (index + 1) & mask) {
+            const size_t home = SlotOf(slots[index].key);
+            const bool reachable = ((index - home) & mask) >= ((index - hole) & mask);
+            if (reachable) {
+                slots[hole] = slots[index];
+                hole = index;
+            }
+        }
+        slots[hole] = Slot{};
+        --count;
+        return true;
+    }
+
+    void Clear() {
+        slots.assign(slots.size(), Slot{});
+        count = 0;
+    }
+
+    size_t Size() const { return count; }
+
+private:
+    static constexpr size_t MIN_CAPACITY = 64;
+
+    struct Slot {
+        u64 key = 0;
+        Value value{};
+    };
+
+    // Fibonacci hashing spreads FNV's weak low bits over the table
+    size_t SlotOf(u64 key) const {
+        return static_cast<size_t>((key * 0x9e3779b97f4a7c15ULL) >> shift);
+    }
+
+    void InsertKey(u64 key, Value value) {
+        for (size_t index = SlotOf(key); ; index = (index + 1) & mask) {
+            Slot& slot = slots[index];
+            if (slot.key == key) {
+                slot.value = value;
+                return;
+            }
+            if (slot.key == 0) {
+                slot = Slot{key, value};
+                ++count;
+                return;
+            }
+        }
+    }
+
+    void Grow() {
+        std::vector<Slot> old = std::move(slots);
+        const size_t capacity = old.empty() ? MIN_CAPACITY : old.size() * 2;
+        slots.assign(capacity, Slot{});
+        mask = capacity - 1;
+        shift = 64 - std::countr_zero(capacity);
+        count = 0;
+        for (const Slot& slot : old) {
+            if (slot.key != 0) InsertKey(slot.key, slot.value);
+        }
+    }
+
+    std::vector<Slot> slots;
+    size_t count = 0;
+    size_t mask = 0;
+    int shift = 64;
+};
+
+#endif //ASSETID_H
@@ -4,18 +4,89 @@
 
 #include "AssetManager.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <limits>
 #include <ranges>
+#include <thread>
+
+#include "Engine.h"
+#include "FontBake.h"
+#include "Log.h"
+#include "TextLayout.h"
+#include "TextureAtlas.h"
+#include "TextureCache.h"
 
 // Static member initialization
+pack::Archive AssetManager::assetPack;
+
 std::unordered_map<std::string_view, AssetManager::TextureData> AssetManager::textures;
 std::unordered_map<i32, std::vector<std::string_view>> AssetManager::sceneOwnedTextures;
+std::unordered_map<std::string_view, AssetManager::SharedTexture> AssetManager::sharedTextures;
+
+// Atlas management
+std::unordered_map<i32, std::vector<Texture>> AssetManager::sceneAtlasPages;
+std::unordered_map<i32, std::vector<Rectangle>> AssetManager::sceneFrameTables;
+std::vector<AssetManager::PendingAtlasEntry> AssetManager::pendingAtlasEntries;
+std::vector<AssetManager::PendingAtlasAlias> AssetManager::pendingAtlasAliases;
+i32 AssetManager::atlasSceneIdentity = AssetManager::NO_ATLAS_SCENE;
 
 // Font management
 std::unordered_map<std::string_view, Font> AssetManager::fonts;
 std::unordered_map<i32, std::vector<std::string_view>> AssetManager::sceneOwnedFonts;
 
+// Residency
+std::atomic<u64> AssetManager::currentFrame{0};
+u64 AssetManager::memoryBudget = 0;
+u64 AssetManager::evictionCount = 0;
+u64 AssetManager::reloadCount = 0;
+u64 AssetManager::residentTextureBytes = 0;
+u64 AssetManager::residentAtlasBytes = 0;
+u64 AssetManager::residentFontBytes = 0;
+u32 AssetManager::textureGeneration = 0;
+
+// Async loading
+std::vector<std::shared_ptr<AssetManager::AsyncLoad>> AssetManager::inFlightLoads;
+std::unordered_map<std::string_view, AssetManager::LoadState> AssetManager::asyncLoadStates;
+std::deque<std::shared_ptr<AssetManager::AsyncLoad>> AssetManager::decodedLoads;
+std::mutex AssetManager::decodedMutex;
+std::unordered_map<i32, std::vector<std::shared_ptr<AssetManager::AsyncLoad>>> AssetManager::stagedAtlasLoads;
+
+// Hashed lookups
+AssetIdMap<AssetManager::TextureData*> AssetManager::textureIndex;
+AssetIdMap<Font*> AssetManager::fontIndex;
+#if GDEBUG
+std::unordered_map<u64, std::string_view> AssetManager::assetIdNames;
+#endif
+
+// Snapshot publication
+std::recursive_mutex AssetManager::writeMutex;
+u32 AssetManager::writeDepth = 0;
+bool AssetManager::lookupsDirty = false;
+std::atomic<const AssetManager::LookupSnapshot*> AssetManager::lookupSnapshot{nullptr};
+std::vector<Font> AssetManager::retiringFonts;
+EpochDomain AssetManager::lookupEpochs;
+
 std::unordered_set<std::string> AssetManager::stringPool;
 
+namespace {
+    u64 TextureBytes(const Texture& texture) {
+        return static_cast<u64>(GetPixelDataSize(texture.width, texture.height, texture.format));
+    }
+
+    // Atlas texture plus the CPU copies of the glyph images
+    u64 FontBytes(const Font& font) {
+        u64 bytes = TextureBytes(font.texture);
+        for (int i = 0; i < font.glyphCount; ++i) {
+            const Image& glyph = font.glyphs[i].image;
+            bytes += static_cast<u64>(GetPixelDataSize(glyph.width, glyph.height, glyph.format));
+        }
+        return bytes;
+    }
+}
+
 std::string_view AssetManager::InternString(std::string_view str) noexcept {
     // Convert string_view to string for lookup
     std::string strKey(str);
@@ -27,6 +98,214 @@ std::string_view AssetManager::InternString(std::string_view str) noexcept {
     return *inserted_it;
 }
 
+bool AssetManager::MountPack(const std::string& file) noexcept {
+    if (!assetPack.Open(file)) {
+        ENGINE_LOG(LOG_INFO, "No asset pack at %s, loading loose files from assets/", file.c_str());
+        return false;
+    }
+    ENGINE_LOG(LOG_INFO, "Mounted asset pack %s (%u files)", file.c_str(), assetPack.GetEntryCount());
+    return true;
+}
+
+std::span<const u8> AssetManager::FindPacked(std::string_view path) noexcept {
+    if (!assetPack.IsOpen()) return {};
+    // The archive stores normalized, '/' separated paths relative to assets/
+    return assetPack.Find(std::filesystem::path(path).lexically_normal().generic_string());
+}
+
+Image AssetManager::LoadAssetImage(std::string_view path) noexcept {
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    const auto elapsedMs = [&start] {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+
+    // Packed sources are validated by their place in the pack and the pack's modification time,
+    // loose ones by their own
+    const std::string file(path);
+    const auto data = FindPacked(path);
+    texture_cache::SourceStamp source{};
+    if (!data.empty()) {
+        source = {data.size(), assetPack.StampOf(data)};
+    } else {
+        std::error_code error;
+        const std::string assetPath = GetAssetPath(path);
+        source.size = std::filesystem::file_size(assetPath, error);
+        if (!error) source.stamp = static_cast<u64>(std::filesystem::last_write_time(assetPath, error).time_since_epoch().count());
+        if (error) return LoadImage(assetPath.c_str());  // Missing file, let raylib report it
+    }
+
+    Image image{};
+    if (texture_cache::Load(path, source, image)) {
+        ENGINE_LOG(LOG_DEBUG, "Loaded %s from the texture cache in %.2f ms (warm)", file.c_str(), elapsedMs());
+        return image;
+    }
+
+    if (!data.empty()) {
+        // Decodes straight out of the mapping
+        image = LoadImageFromMemory(GetFileExtension(file.c_str()), data.data(), static_cast<int>(data.size()));
+    } else {
+        image = LoadImage(GetAssetPath(path).c_str());
+    }
+    const double decodeMs = elapsedMs();
+
+    texture_cache::Save(path, source, image);
+    ENGINE_LOG(LOG_DEBUG, "Decoded %s in %.2f ms (cold), cached in %.2f ms", file.c_str(), decodeMs, elapsedMs() - decodeMs);
+    return image;
+}
+
+bool AssetManager::LoadBakedFont(std::string_view path, int fontSize, Font& font, Image& atlas) noexcept {
+    const std::string bakedPath = font_bake::BakedPath(path, fontSize);
+    if (const auto data = FindPacked(bakedPath); !data.empty()) {
+        return font_bake::Load(data, font, atlas);
+    }
+
+    const std::string file = GetAssetPath(bakedPath);
+    if (!FileExists(file.c_str())) return false;
+    int dataSize = 0;
+    unsigned char* data = LoadFileData(file.c_str(), &dataSize);
+    const bool loaded = data != nullptr && font_bake::Load(std::span<const u8>(data, static_cast<size_t>(dataSize)), font, atlas);
+    UnloadFileData(data);
+    return loaded;
+}
+
+Font AssetManager::LoadAssetFont(std::string_view path, int fontSize, int* codepoints, int codepointCount) noexcept {
+    const std::string file(path);
+
+    // Subsets baked by font_baker skip rasterization; explicit codepoint lists always rasterize
+    if (codepoints == nullptr) {
+        const auto start = std::chrono::steady_clock::now();
+        Font font{};
+        Image atlas{};
+        if (LoadBakedFont(path, fontSize > 0 ? fontSize : DEFAULT_FONT_SIZE, font, atlas)) {
+            font.texture = LoadTextureFromImage(atlas);
+            UnloadImage(atlas);
+            ENGINE_LOG(LOG_DEBUG, "Loaded baked %s (%d glyphs, %dx%d atlas) in %.2f ms", file.c_str(), font.glyphCount,
+                       font.texture.width, font.texture.height,
+                       std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            return font;
+        }
+    }
+
+    if (const auto data = FindPacked(path); !data.empty()) {
+        return LoadFontFromMemory(GetFileExtension(file.c_str()), data.data(), static_cast<int>(data.size()),
+                                  fontSize > 0 ? fontSize : DEFAULT_FONT_SIZE, codepoints, codepointCount);
+    }
+    if (fontSize > 0) {
+        return LoadFontEx(GetAssetPath(path).c_str(), fontSize, codepoints, codepointCount);
+    }
+    return LoadFont(GetAssetPath(path).c_str());
+}
+
+void AssetManager::CheckAssetId([[maybe_unused]] std::string_view name) noexcept {
+#if GDEBUG
+    // Hashed lookups can't tell two names apart, so a collision must be caught when registering
+    const auto [it, inserted] = assetIdNames.try_emplace(AssetId(name).value, name);
+    if (!inserted && it->second != name) {
+        ENGINE_LOG(LOG_ERROR, "Asset id collision between '%s' and '%s'", it->second.data(), name.data());
+    }
+#endif
+}
+
+void AssetManager::IndexTexture(std::string_view name, TextureData& textureData) noexcept {
+    CheckAssetId(name);
+    // Zero is never handed out, it marks an empty TextureHandle
+    if (++textureGeneration == 0) ++textureGeneration;
+    textureData.generation = textureGeneration;
+    textureIndex.Insert(AssetId(name), &textureData);
+    lookupsDirty = true;
+}
+
+void AssetManager::IndexFont(std::string_view name, Font& font) noexcept {
+    CheckAssetId(name);
+    fontIndex.Insert(AssetId(name), &font);
+    lookupsDirty = true;
+}
+
+AssetManager::WriteScope::WriteScope() {
+    writeMutex.lock();
+    ++writeDepth;
+}
+
+AssetManager::WriteScope::~WriteScope() {
+    if (--writeDepth == 0) {
+        if (lookupsDirty) PublishLookups();
+        lookupEpochs.Reclaim();
+    }
+    writeMutex.unlock();
+}
+
+void AssetManager::PublishLookups() noexcept {
+    const LookupSnapshot* previous = lookupSnapshot.load(std::memory_order_relaxed);
+    auto* snapshot = new LookupSnapshot{};
+    snapshot->version = previous != nullptr ? previous->version + 1 : 1;
+
+    // Reserved up front so the views' spans stay put while the table fills
+    size_t frameCount = 0;
+    for (const auto& textureData : textures | std::views::values) {
+        frameCount += textureData.frames.count;
+    }
+    snapshot->framePositions.reserve(frameCount);
+
+    for (const auto& [name, textureData] : textures) {
+        const size_t firstFrame = snapshot->framePositions.size();
+        const auto frames = GetFrameTable(textureData.frames.table).subspan(textureData.frames.first, textureData.frames.count);
+        snapshot->framePositions.insert(snapshot->framePositions.end(), frames.begin(), frames.end());
+        snapshot->textures.Insert(AssetId(name), TextureView{
+            textureData.texture,
+            textureData.type,
+            textureData.gridSize,
+            textureData.tileGrid,
+            textureData.region,
+            std::span<const Rectangle>(snapshot->framePositions.data() + firstFrame, frames.size()),
+            textureData.frames,
+            textureData.generation
+        });
+    }
+    for (const auto& [name, font] : fonts) {
+        snapshot->fonts.Insert(AssetId(name), font);
+    }
+
+    // Retired only after the swap, so a reader that still sees them keeps them alive
+    lookupSnapshot.store(snapshot, std::memory_order_seq_cst);
+    if (previous != nullptr) {
+        lookupEpochs.Retire([previous] { delete previous; });
+    }
+    if (!retiringFonts.empty()) {
+        lookupEpochs.Retire([unloaded = std::move(retiringFonts)] {
+            for (const Font& font : unloaded) ::UnloadFont(font);
+        });
+        retiringFonts.clear();
+    }
+    lookupsDirty = false;
+}
+
+AssetManager::ReadScope::ReadScope() noexcept {
+    lookupEpochs.Enter();
+    snapshot = lookupSnapshot.load(std::memory_order_seq_cst);
+}
+
+AssetManager::ReadScope::~ReadScope() {
+    lookupEpochs.Exit();
+}
+
+const AssetManager::TextureView* AssetManager::ReadScope::FindTexture(AssetId id) const noexcept {
+    return snapshot != nullptr ? snapshot->textures.Find(id) : nullptr;
+}
+
+AssetManager::TextureHandle AssetManager::ReadScope::FindTextureHandle(AssetId id) const noexcept {
+    const TextureView* texture = FindTexture(id);
+    return texture != nullptr ? TextureHandle{id, texture->generation} : TextureHandle{};
+}
+
+const Font* AssetManager::ReadScope::FindFont(AssetId id) const noexcept {
+    return snapshot != nullptr ? snapshot->fonts.Find(id) : nullptr;
+}
+
+u64 AssetManager::ReadScope::Version() const noexcept {
+    return snapshot != nullptr ? snapshot->version : 0;
+}
+
 std::string AssetManager::GetAssetPath(std::string_view path) noexcept {
     std::string fullPath;
     fullPath.reserve(7 + path.length()); // "assets/" + path length
@@ -35,167 +314,998 @@ std::string AssetManager::GetAssetPath(std::string_view path) noexcept {
     return fullPath;
 }
 
-void AssetManager::CalculateFramePositions(std::string_view name, const Texture& texture, const Vector2Int& gridSize) noexcept {
-    const int framesPerRow = texture.width / gridSize.x;
-    const int totalFrames = (texture.width / gridSize.x) * (texture.height / gridSize.y);
-    
-    auto& textureData = textures[InternString(name)];
-    textureData.framePositions.clear();
-    textureData.framePositions.reserve(totalFrames);
+std::string_view AssetManager::CanonicalPath(std::string_view path) noexcept {
+    // Different spellings of the same file ("./a.png", "sub/../a.png") must map to one texture
+    const std::string assetPath = GetAssetPath(path);
+    std::error_code error;
+    const std::filesystem::path canonical = std::filesystem::weakly_canonical(assetPath, error);
+    return InternString(error ? assetPath : canonical.generic_string());
+}
+
+bool AssetManager::ShareTexture(TextureData& textureData, std::string_view sourcePath, i32 sceneIdentity) noexcept {
+    const auto it = sharedTextures.find(sourcePath);
+    if (it == sharedTextures.end()) return false;
+
+    SharedTexture& shared = it->second;
+    // Atlas pages are released with their scene, so only that scene may alias them
+    if (shared.atlased && shared.sceneIdentity != sceneIdentity) return false;
+
+    ++shared.refCount;
+    textureData.texture = shared.texture;
+    textureData.region = shared.region;
+    textureData.atlased = shared.atlased;
+    textureData.sourcePath = sourcePath;
+    textureData.residency = shared.residency.get();
+    return true;
+}
+
+void AssetManager::RegisterSharedTexture(TextureData& textureData, std::string_view sourcePath, std::string_view assetPath,
+                                         i32 sceneIdentity, u32 references) noexcept {
+    if (textureData.texture.id == 0) return;  // Failed to load, nothing to share
+
+    const Texture& texture = textureData.texture;
+    SharedTexture shared{
+        texture,
+        textureData.region,
+        textureData.atlased,
+        sceneIdentity,
+        references,
+        std::string(assetPath),
+        // Atlas pages are accounted per scene, not per image
+        textureData.atlased ? 0 : static_cast<u64>(GetPixelDataSize(texture.width, texture.height, texture.format)),
+        textureData.atlased ? nullptr : std::make_unique<Residency>()
+    };
+    if (shared.residency) shared.residency->lastUsedFrame.store(currentFrame.load(std::memory_order_relaxed));
+
+    // Another scene's atlas may already hold this path; the texture then stays private
+    if (const auto [it, inserted] = sharedTextures.try_emplace(sourcePath, std::move(shared)); inserted) {
+        textureData.sourcePath = sourcePath;
+        textureData.residency = it->second.residency.get();
+        residentTextureBytes += it->second.bytes;
+    }
+}
+
+void AssetManager::ReleaseSharedTexture(const TextureData& textureData) noexcept {
+    if (textureData.sourcePath.empty()) {
+        // Atlas pages are shared and released together with their scene
+        if (!textureData.atlased) ::UnloadTexture(textureData.texture);
+        return;
+    }
+
+    const auto it = sharedTextures.find(textureData.sourcePath);
+    if (it == sharedTextures.end() || --it->second.refCount > 0) return;
+
+    if (!it->second.atlased && it->second.texture.id != 0) {
+        ::UnloadTexture(it->second.texture);
+        residentTextureBytes -= it->second.bytes;
+    }
+    sharedTextures.erase(it);
+}
+
+void AssetManager::CalculateFramePositions(TextureData& textureData, i32 sceneIdentity) noexcept {
+    const Rectangle& region = textureData.region;
+    const Vector2Int& gridSize = textureData.gridSize;
+    const int framesPerRow = static_cast<int>(region.width) / gridSize.x;
+    const int totalFrames = framesPerRow * (static_cast<int>(region.height) / gridSize.y);
+
+    // Aliases of one image cut the same frames, they share the slice
+    for (const auto& other : textures | std::views::values) {
+        if (&other == &textureData || other.frames.count == 0 || other.frames.table != sceneIdentity) continue;
+        if (other.gridSize.x == gridSize.x && other.gridSize.y == gridSize.y &&
+            other.region.x == region.x && other.region.y == region.y &&
+            other.region.width == region.width && other.region.height == region.height) {
+            textureData.frames = other.frames;
+            return;
+        }
+    }
+
+    auto& table = sceneFrameTables[sceneIdentity];
+    textureData.frames = FrameRange{sceneIdentity, static_cast<u32>(table.size()), static_cast<u32>(totalFrames)};
+    table.reserve(table.size() + totalFrames);
     
     for (int i = 0; i < totalFrames; ++i) {
         const int row = i / framesPerRow;
         const int col = i % framesPerRow;
         
-        textureData.framePositions.emplace_back(
-            static_cast<float>(col * gridSize.x),
-            static_cast<float>(row * gridSize.y),
+        table.emplace_back(
+            region.x + static_cast<float>(col * gridSize.x),
+            region.y + static_cast<float>(row * gridSize.y),
             static_cast<float>(gridSize.x),
             static_cast<float>(gridSize.y)
         );
     }
 }
 
-void AssetManager::CalculateTilePositions(std::string_view name, const Texture& texture, const Vector2Int& tileSize) noexcept {
-    const int tilesPerRow = texture.width / tileSize.x;
-    const int tilesPerCol = texture.height / tileSize.y;
-    
-    auto& textureData = textures[InternString(name)];
-    textureData.tilePositions.clear();
-    textureData.tilePositions.resize(tilesPerCol);
-    
+void AssetManager::ReleaseFrames(FrameRange frames) noexcept {
+    if (frames.count == 0) return;
+    const bool shared = std::ranges::any_of(textures | std::views::values, [&frames](const TextureData& other) {
+        return other.frames.count > 0 && other.frames.table == frames.table && other.frames.first == frames.first;
+    });
+    const auto it = sceneFrameTables.find(frames.table);
+    if (shared || it == sceneFrameTables.end()) return;
+
+    // Close the gap so replacing a texture over and over doesn't grow the table
+    auto& table = it->second;
+    table.erase(table.begin() + frames.first, table.begin() + frames.first + frames.count);
+    for (auto& textureData : textures | std::views::values) {
+        if (textureData.frames.table == frames.table && textureData.frames.first > frames.first) {
+            textureData.frames.first -= frames.count;
+        }
+    }
+    lookupsDirty = true;
+}
+
+void AssetManager::CalculateTileUVs(TextureData& textureData) noexcept {
+    const Rectangle& region = textureData.region;
+    const Vector2Int& tileSize = textureData.gridSize;
+    const int tilesPerRow = static_cast<int>(region.width) / tileSize.x;
+    const int tilesPerCol = static_cast<int>(region.height) / tileSize.y;
+
+    textureData.tileGrid = Vector2Int{0, 0};
+    textureData.tileUVs.clear();
+    if (textureData.texture.width == 0 || textureData.texture.height == 0) return;  // Failed to load
+
+    // UVs are relative to the whole texture, which is an atlas page for atlased images
+    const float invWidth = 1.0f / static_cast<float>(textureData.texture.width);
+    const float invHeight = 1.0f / static_cast<float>(textureData.texture.height);
+
+    textureData.tileGrid = Vector2Int{tilesPerRow, tilesPerCol};
+    textureData.tileUVs.reserve(static_cast<size_t>(tilesPerRow) * tilesPerCol);
+
     for (int row = 0; row < tilesPerCol; ++row) {
-        textureData.tilePositions[row].reserve(tilesPerRow);
         for (int col = 0; col < tilesPerRow; ++col) {
-            textureData.tilePositions[row].emplace_back(
-                static_cast<float>(col * tileSize.x),
-                static_cast<float>(row * tileSize.y),
-                static_cast<float>(tileSize.x),
-                static_cast<float>(tileSize.y)
-            );
+            const float x = region.x + static_cast<float>(col * tileSize.x);
+            const float y = region.y + static_cast<float>(row * tileSize.y);
+            textureData.tileUVs.push_back(TileUV{
+                x * invWidth,
+                y * invHeight,
+                (x + static_cast<float>(tileSize.x)) * invWidth,
+                (y + static_cast<float>(tileSize.y)) * invHeight
+            });
         }
     }
 }
 
-void AssetManager::AddSceneTexture(std::string_view name, std::string_view path, i32 sceneIdentity) noexcept {
+void AssetManager::AddSceneTexture(std::string_view name, std::string_view path, i32 sceneIdentity, TextureType type, Vector2Int gridSize,
+                                   Image decoded) noexcept {
+    WriteScope write;
     std::string_view internedName = InternString(name);
-    Texture texture = LoadTexture(GetAssetPath(path).c_str());
-    textures[internedName] = TextureData{
-        std::move(texture),
-        TextureType::Single,
+    DropReplacedTexture(internedName);
+
+    auto& textureData = textures[internedName];
+    textureData = TextureData{
+        Texture{},
+        type,
+        gridSize,
+        {},
         Vector2Int{0, 0},
         {},
-        {}
+        Rectangle{},
+        false
     };
+    IndexTexture(internedName, textureData);
     sceneOwnedTextures[sceneIdentity].push_back(internedName);
+
+    const std::string_view sourcePath = CanonicalPath(path);
+    if (!ShareTexture(textureData, sourcePath, sceneIdentity)) {
+        const bool batching = atlasSceneIdentity == sceneIdentity;
+        if (batching) {
+            const auto pending = std::ranges::find(pendingAtlasEntries, sourcePath, &PendingAtlasEntry::sourcePath);
+            if (pending != pendingAtlasEntries.end()) {
+                // Same image under another name, resolved by EndSceneAtlas together with the original
+                pendingAtlasAliases.push_back({internedName, static_cast<size_t>(pending - pendingAtlasEntries.begin())});
+                if (decoded.data != nullptr) UnloadImage(decoded);
+                return;
+            }
+        }
+
+        Image image = decoded.data != nullptr ? decoded : LoadAssetImage(path);
+        if (batching && image.data != nullptr && image.width <= atlas::MAX_ENTRY_SIZE && image.height <= atlas::MAX_ENTRY_SIZE) {
+            // Resolved by EndSceneAtlas once the page layout is known
+            pendingAtlasEntries.push_back({internedName, std::string(path), image, sourcePath});
+            return;
+        }
+        textureData.texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+
+        textureData.region = Rectangle{
+            0.0f, 0.0f,
+            static_cast<float>(textureData.texture.width),
+            static_cast<float>(textureData.texture.height)
+        };
+        RegisterSharedTexture(textureData, sourcePath, path, sceneIdentity, 1);
+    } else if (decoded.data != nullptr) {
+        UnloadImage(decoded);
+    }
+
+    if (type == TextureType::Animated) CalculateFramePositions(textureData, sceneIdentity);
+    if (type == TextureType::Tiled) CalculateTileUVs(textureData);
+}
+
+void AssetManager::AddSceneTexture(std::string_view name, std::string_view path, i32 sceneIdentity) noexcept {
+    AddSceneTexture(name, path, sceneIdentity, TextureType::Single, Vector2Int{0, 0});
 }
 
 void AssetManager::AddSceneAnimatedTexture(std::string_view name, std::string_view path, i32 sceneIdentity, Vector2Int gridSquareSize) noexcept {
-    std::string_view internedName = InternString(name);
-    Texture texture = LoadTexture(GetAssetPath(path).c_str());
-    textures[internedName] = TextureData{
-        std::move(texture),
-        TextureType::Animated,
-        gridSquareSize,
-        {},
-        {}
-    };
-    CalculateFramePositions(name, textures[internedName].texture, gridSquareSize);
-    sceneOwnedTextures[sceneIdentity].push_back(internedName);
+    AddSceneTexture(name, path, sceneIdentity, TextureType::Animated, gridSquareSize);
 }
 
 void AssetManager::AddSceneTiledTexture(std::string_view name, std::string_view path, i32 sceneIdentity, Vector2Int tileSize) noexcept {
-    std::string_view internedName = InternString(name);
-    Texture texture = LoadTexture(GetAssetPath(path).c_str());
-    textures[internedName] = TextureData{
-        std::move(texture),
-        TextureType::Tiled,
-        tileSize,
-        {},
-        {}
-    };
-    CalculateTilePositions(name, textures[internedName].texture, tileSize);
-    sceneOwnedTextures[sceneIdentity].push_back(internedName);
+    AddSceneTexture(name, path, sceneIdentity, TextureType::Tiled, tileSize);
 }
 
-void AssetManager::AddSceneFont(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize) noexcept {
-    Font font;
-    if (fontSize > 0) {
-        font = LoadFontEx(GetAssetPath(path).c_str(), fontSize, nullptr, 0);
-    } else {
-        font = LoadFont(GetAssetPath(path).c_str());
+void AssetManager::BeginSceneAtlas(i32 sceneIdentity) noexcept {
+    WriteScope write;
+    if (atlasSceneIdentity != NO_ATLAS_SCENE) {
+        ENGINE_LOG(LOG_WARNING, "BeginSceneAtlas(%d) called while scene %d is still batching", sceneIdentity, atlasSceneIdentity);
+        return;
     }
-    
+    atlasSceneIdentity = sceneIdentity;
+}
+
+void AssetManager::EndSceneAtlas(i32 sceneIdentity) noexcept {
+    WriteScope write;
+    if (atlasSceneIdentity != sceneIdentity) {
+        ENGINE_LOG(LOG_WARNING, "EndSceneAtlas(%d) called without a matching BeginSceneAtlas", sceneIdentity);
+        return;
+    }
+    atlasSceneIdentity = NO_ATLAS_SCENE;
+    if (pendingAtlasEntries.empty()) return;
+
+    std::vector<atlas::Entry> entries;
+    entries.reserve(pendingAtlasEntries.size());
+    for (const auto& pending : pendingAtlasEntries) {
+        entries.push_back({pending.name, pending.path, pending.image.width, pending.image.height});
+    }
+
+    // Reuse the cached layout when the scene's texture set has not changed
+    const std::string layoutFile = std::string(ATLAS_CACHE_DIRECTORY) + "atlas_scene" + std::to_string(sceneIdentity) + ".bin";
+    std::vector<atlas::Placement> placements;
+    i32 pageCount = 0;
+    if (!atlas::LoadLayout(layoutFile, entries, placements, pageCount)) {
+        pageCount = atlas::Pack(entries, placements);
+        atlas::SaveLayout(layoutFile, entries, placements, pageCount);
+        ENGINE_LOG(LOG_INFO, "Packed %zu textures into %d atlas page(s) for scene %d", entries.size(), pageCount, sceneIdentity);
+    }
+
+    // Compose the pages on the CPU so each one is uploaded exactly once
+    std::vector<Image> pageImages;
+    pageImages.reserve(pageCount);
+    for (i32 page = 0; page < pageCount; ++page) {
+        pageImages.push_back(GenImageColor(atlas::PAGE_SIZE, atlas::GetPageHeight(entries, placements, page), BLANK));
+    }
+
+    for (size_t i = 0; i < pendingAtlasEntries.size(); ++i) {
+        if (placements[i].page < 0) continue;
+
+        Image& image = pendingAtlasEntries[i].image;
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+        const Image& page = pageImages[placements[i].page];
+        const size_t rowBytes = static_cast<size_t>(image.width) * 4;
+        for (int row = 0; row < image.height; ++row) {
+            const size_t pageOffset = (static_cast<size_t>(placements[i].y + row) * page.width + placements[i].x) * 4;
+            std::memcpy(static_cast<u8*>(page.data) + pageOffset,
+                        static_cast<const u8*>(image.data) + row * rowBytes,
+                        rowBytes);
+        }
+    }
+
+    auto& scenePages = sceneAtlasPages[sceneIdentity];
+    const size_t firstPage = scenePages.size();
+    for (Image& pageImage : pageImages) {
+        scenePages.push_back(LoadTextureFromImage(pageImage));
+        residentAtlasBytes += TextureBytes(scenePages.back());
+        UnloadImage(pageImage);
+    }
+
+    for (size_t i = 0; i < pendingAtlasEntries.size(); ++i) {
+        auto& pending = pendingAtlasEntries[i];
+        auto& textureData = textures[pending.name];
+
+        if (placements[i].page < 0) {
+            // Did not fit anywhere, fall back to a standalone texture
+            textureData.texture = LoadTextureFromImage(pending.image);
+            textureData.region = Rectangle{0.0f, 0.0f, static_cast<float>(pending.image.width), static_cast<float>(pending.image.height)};
+        } else {
+            textureData.texture = scenePages[firstPage + placements[i].page];
+            textureData.region = Rectangle{
+                static_cast<float>(placements[i].x),
+                static_cast<float>(placements[i].y),
+                static_cast<float>(pending.image.width),
+                static_cast<float>(pending.image.height)
+            };
+            textureData.atlased = true;
+        }
+
+        const auto aliasCount = std::ranges::count(pendingAtlasAliases, i, &PendingAtlasAlias::entry);
+        RegisterSharedTexture(textureData, pending.sourcePath, pending.path, sceneIdentity, 1 + static_cast<u32>(aliasCount));
+
+        if (textureData.type == TextureType::Animated) CalculateFramePositions(textureData, sceneIdentity);
+        if (textureData.type == TextureType::Tiled) CalculateTileUVs(textureData);
+        UnloadImage(pending.image);
+    }
+
+    for (const auto& alias : pendingAtlasAliases) {
+        const auto& original = textures[pendingAtlasEntries[alias.entry].name];
+        auto& textureData = textures[alias.name];
+        textureData.texture = original.texture;
+        textureData.region = original.region;
+        textureData.atlased = original.atlased;
+        textureData.sourcePath = original.sourcePath;
+        textureData.residency = original.residency;
+
+        if (textureData.type == TextureType::Animated) CalculateFramePositions(textureData, sceneIdentity);
+        if (textureData.type == TextureType::Tiled) CalculateTileUVs(textureData);
+    }
+    pendingAtlasEntries.clear();
+    pendingAtlasAliases.clear();
+    lookupsDirty = true;
+}
+
+void AssetManager::AddSceneFont(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize) noexcept {
+    WriteScope write;
+    RegisterFont(name, LoadAssetFont(path, fontSize, nullptr, 0), sceneIdentity);
+}
+
+void AssetManager::AddSceneFontWithCodepoints(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize, const std::vector<int>& codepoints) noexcept {
+    WriteScope write;
+    Font font = LoadAssetFont(path, fontSize > 0 ? fontSize : 10,
+                              const_cast<int*>(codepoints.data()), static_cast<int>(codepoints.size()));
+    RegisterFont(name, font, sceneIdentity);
+}
+
+void AssetManager::RegisterFont(std::string_view name, Font font, i32 sceneIdentity) noexcept {
     std::string_view internedName = InternString(name);
-    fonts.emplace(internedName, std::move(font));
+    const auto [it, inserted] = fonts.emplace(internedName, font);
+    if (!inserted) {
+        ENGINE_LOG(LOG_WARNING, "Font '%s' is already loaded, dropping the new copy", internedName.data());
+        ::UnloadFont(font);
+        return;
+    }
+    residentFontBytes += FontBytes(font);
+    IndexFont(internedName, it->second);
     sceneOwnedFonts[sceneIdentity].push_back(internedName);
 }
 
-void AssetManager::AddSceneFontWithCodepoints(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize, const std::vector<int>& codepoints) noexcept {
-    Font font;
-    if (fontSize > 0) {
-        font = LoadFontEx(GetAssetPath(path).c_str(), fontSize, const_cast<int*>(codepoints.data()), static_cast<int>(codepoints.size()));
+std::shared_ptr<AssetManager::AsyncLoad> AssetManager::MakeTextureLoad(std::string_view name, std::string_view path, i32 sceneIdentity,
+                                                                       TextureType type, Vector2Int gridSize) noexcept {
+    auto load = std::make_shared<AsyncLoad>();
+    load->kind = AsyncLoad::Kind::Texture;
+    load->name = InternString(name);
+    load->path = std::string(path);
+    load->sourcePath = CanonicalPath(path);
+    load->sceneIdentity = sceneIdentity;
+    load->type = type;
+    load->gridSize = gridSize;
+    load->fontSize = 0;
+    return load;
+}
+
+std::shared_ptr<AssetManager::AsyncLoad> AssetManager::MakeFontLoad(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize) noexcept {
+    auto load = std::make_shared<AsyncLoad>();
+    load->kind = AsyncLoad::Kind::Font;
+    load->name = InternString(name);
+    load->path = std::string(path);
+    load->sceneIdentity = sceneIdentity;
+    load->type = TextureType::Single;
+    load->gridSize = Vector2Int{0, 0};
+    load->fontSize = fontSize > 0 ? fontSize : DEFAULT_FONT_SIZE;
+    return load;
+}
+
+std::shared_future<AssetManager::LoadState> AssetManager::AddSceneTextureAsync(std::string_view name, std::string_view path, i32 sceneIdentity,
+                                                                             TextureType type, Vector2Int gridSize) noexcept {
+    WriteScope write;
+    return QueueAsyncLoad(MakeTextureLoad(name, path, sceneIdentity, type, gridSize));
+}
+
+std::shared_future<AssetManager::LoadState> AssetManager::AddSceneFontAsync(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize) noexcept {
+    WriteScope write;
+    return QueueAsyncLoad(MakeFontLoad(name, path, sceneIdentity, fontSize));
+}
+
+bool AssetManager::IsRegistered(const ManifestEntry& entry) noexcept {
+    if (entry.kind == ManifestEntry::Kind::Font) return fontIndex.Find(AssetId(entry.name)) != nullptr;
+    return textureIndex.Find(AssetId(entry.name)) != nullptr;
+}
+
+void AssetManager::PreloadManifest(std::span<const ManifestEntry> manifest, i32 sceneIdentity) noexcept {
+    WriteScope write;
+    for (const ManifestEntry& entry : manifest) {
+        if (IsRegistered(entry) || GetLoadState(entry.name) == LoadState::Pending) continue;
+
+        std::shared_ptr<AsyncLoad> load = entry.kind == ManifestEntry::Kind::Font
+            ? MakeFontLoad(entry.name, entry.path, sceneIdentity, entry.fontSize)
+            : MakeTextureLoad(entry.name, entry.path, sceneIdentity, entry.type, entry.gridSize);
+        load->atlas = entry.atlas;
+        load->streamed = entry.streamed;
+        QueueAsyncLoad(std::move(load));
+    }
+}
+
+void AssetManager::LoadManifest(std::span<const ManifestEntry> manifest, i32 sceneIdentity) noexcept {
+    WriteScope write;
+    FinishSceneLoads(sceneIdentity);
+
+    for (const ManifestEntry& entry : manifest) {
+        if (entry.atlas || IsRegistered(entry) || GetLoadState(entry.name) == LoadState::Pending) continue;
+
+        if (entry.kind == ManifestEntry::Kind::Font) {
+            AddSceneFont(entry.name, entry.path, sceneIdentity, entry.fontSize);
+        } else if (entry.streamed) {
+            AddSceneTextureAsync(entry.name, entry.path, sceneIdentity, entry.type, entry.gridSize);
+        } else {
+            AddSceneTexture(entry.name, entry.path, sceneIdentity, entry.type, entry.gridSize);
+        }
+    }
+
+    // Atlas entries that were not preloaded still share pages with each other
+    const bool missingAtlasEntries = std::ranges::any_of(manifest, [](const ManifestEntry& entry) {
+        return entry.atlas && !IsRegistered(entry);
+    });
+    if (!missingAtlasEntries) return;
+
+    BeginSceneAtlas(sceneIdentity);
+    for (const ManifestEntry& entry : manifest) {
+        if (entry.atlas && !IsRegistered(entry)) {
+            AddSceneTexture(entry.name, entry.path, sceneIdentity, entry.type, entry.gridSize);
+        }
+    }
+    EndSceneAtlas(sceneIdentity);
+}
+
+void AssetManager::FinishSceneLoads(i32 sceneIdentity) noexcept {
+    const auto waiting = [sceneIdentity] {
+        return std::ranges::any_of(inFlightLoads, [sceneIdentity](const auto& load) {
+            return load->sceneIdentity == sceneIdentity && !load->streamed && !load->cancelled.load(std::memory_order_relaxed);
+        });
+    };
+
+    // Only reached when the switch came before the preload finished
+    while (waiting()) {
+        ProcessUploads(std::numeric_limits<double>::max());
+        ComposeStagedAtlases();
+        if (waiting()) std::this_thread::yield();
+    }
+    ComposeStagedAtlases();
+}
+
+std::shared_ptr<AssetManager::AsyncLoad> AssetManager::FindPendingLoad(const std::function<bool(const AsyncLoad&)>& match) noexcept {
+    const auto pending = [&](const std::shared_ptr<AsyncLoad>& load) {
+        return load->kind != AsyncLoad::Kind::Reload && !load->cancelled.load(std::memory_order_relaxed) && match(*load);
+    };
+    for (const auto& load : inFlightLoads) {
+        if (pending(load)) return load;
+    }
+    for (const auto& loads : stagedAtlasLoads | std::views::values) {
+        for (const auto& load : loads) {
+            if (pending(load)) return load;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_future<AssetManager::LoadState> AssetManager::QueueAsyncLoad(std::shared_ptr<AsyncLoad> load) noexcept {
+    // A second request for a name that is still loading gets the first request's result
+    if (load->kind != AsyncLoad::Kind::Reload) {
+        const auto pending = FindPendingLoad([&load](const AsyncLoad& other) {
+            return other.kind == load->kind && (other.name == load->name || std::ranges::any_of(other.aliases,
+                [&load](const auto& alias) { return alias->name == load->name; }));
+        });
+        if (pending) {
+            if (pending->name == load->name) return pending->future;
+            return (*std::ranges::find(pending->aliases, load->name, &AsyncLoad::name))->future;
+        }
+    }
+
+    load->future = load->promise.get_future().share();
+    std::shared_future<LoadState> future = load->future;
+
+    // Already resident under another name, alias it without touching the disk
+    if (load->kind == AsyncLoad::Kind::Texture && sharedTextures.contains(load->sourcePath)) {
+        load->promise.set_value(UploadAsyncLoad(*load) ? LoadState::Loaded : LoadState::Failed);
+        return future;
+    }
+
+    if (load->kind != AsyncLoad::Kind::Reload) asyncLoadStates[load->name] = LoadState::Pending;
+
+    // Same file under another name, still decoding: settled together with it, not read again.
+    // Atlased images only alias within their scene's pages.
+    if (load->kind == AsyncLoad::Kind::Texture) {
+        const auto pending = FindPendingLoad([&load](const AsyncLoad& other) {
+            return other.kind == AsyncLoad::Kind::Texture && other.sourcePath == load->sourcePath &&
+                   other.sceneIdentity == load->sceneIdentity && other.atlas == load->atlas;
+        });
+        if (pending) {
+            pending->aliases.push_back(load);
+            return future;
+        }
+    }
+
+    inFlightLoads.push_back(load);
+
+    auto decode = [load] {
+        if (!load->cancelled.load(std::memory_order_relaxed)) {
+            DecodeAsyncLoad(*load);
+        }
+        std::lock_guard lock(decodedMutex);
+        decodedLoads.push_back(load);
+    };
+
+    // Before the engine runs, or with a full queue, decode here and still upload through the queue
+    if (!Engine::QueueWorkerTask(decode)) {
+        decode();
+    }
+    return future;
+}
+
+void AssetManager::DecodeAsyncLoad(AsyncLoad& load) noexcept {
+    if (load.kind != AsyncLoad::Kind::Font) {
+        load.image = LoadAssetImage(load.path);
+        return;
+    }
+
+    Font baked{};
+    if (LoadBakedFont(load.path, load.fontSize, baked, load.image)) {
+        load.glyphs = baked.glyphs;
+        load.recs = baked.recs;
+        load.glyphCount = baked.glyphCount;
+        return;
+    }
+
+    // Packed fonts rasterize straight from the mapping; loose ones are read first
+    std::span<const u8> data = FindPacked(load.path);
+    unsigned char* fileData = nullptr;
+    if (data.empty()) {
+        int dataSize = 0;
+        fileData = LoadFileData(GetAssetPath(load.path).c_str(), &dataSize);
+        if (fileData == nullptr) return;
+        data = std::span<const u8>(fileData, static_cast<size_t>(dataSize));
+    }
+
+    load.glyphs = LoadFontData(data.data(), static_cast<int>(data.size()), load.fontSize, nullptr, 0, FONT_DEFAULT);
+    if (load.glyphs != nullptr) {
+        load.glyphCount = DEFAULT_FONT_GLYPHS;
+        load.image = GenImageFontAtlas(load.glyphs, &load.recs, load.glyphCount, load.fontSize, FONT_GLYPH_PADDING, 0);
+    }
+    if (fileData != nullptr) UnloadFileData(fileData);
+}
+
+void AssetManager::SettleAliases(AsyncLoad& load, LoadState state) noexcept {
+    for (const auto& alias : load.aliases) {
+        // The file is resident by now, so the alias only shares it
+        LoadState aliasState = state;
+        if (state == LoadState::Loaded && !UploadAsyncLoad(*alias)) aliasState = LoadState::Failed;
+
+        if (aliasState == LoadState::Failed) {
+            asyncLoadStates[alias->name] = LoadState::Failed;
+        } else {
+            asyncLoadStates.erase(alias->name);
+        }
+        alias->promise.set_value(aliasState);
+    }
+    load.aliases.clear();
+}
+
+bool AssetManager::UploadAsyncLoad(AsyncLoad& load) noexcept {
+    if (load.kind == AsyncLoad::Kind::Texture) {
+        TextureData textureData{Texture{}, load.type, load.gridSize, {}, Vector2Int{0, 0}, {}, Rectangle{}, false};
+        if (ShareTexture(textureData, load.sourcePath, load.sceneIdentity)) {
+            // Someone else loaded the same file meanwhile, the decoded copy is not needed
+            if (load.image.data != nullptr) UnloadImage(load.image);
+            // Dropped after sharing, so reloading a name from the same file keeps it on the GPU
+            DropReplacedTexture(load.name);
+            auto& registered = textures[load.name] = std::move(textureData);
+            IndexTexture(load.name, registered);
+            if (load.type == TextureType::Animated) CalculateFramePositions(registered, load.sceneIdentity);
+            if (load.type == TextureType::Tiled) CalculateTileUVs(registered);
+            sceneOwnedTextures[load.sceneIdentity].push_back(load.name);
+            return true;
+        }
+    }
+
+    if (load.image.data == nullptr) {
+        ENGINE_LOG(LOG_WARNING, "Async load of '%s' failed", load.path.c_str());
+        if (load.glyphs != nullptr) UnloadFontData(load.glyphs, load.glyphCount);
+        MemFree(load.recs);
+        return false;
+    }
+
+    if (load.kind == AsyncLoad::Kind::Texture) {
+        DropReplacedTexture(load.name);
+        auto& textureData = textures[load.name];
+        textureData = TextureData{
+            LoadTextureFromImage(load.image),
+            load.type,
+            load.gridSize,
+            {},
+            Vector2Int{0, 0},
+            {},
+            Rectangle{},
+            false
+        };
+        textureData.region = Rectangle{
+            0.0f, 0.0f,
+            static_cast<float>(textureData.texture.width),
+            static_cast<float>(textureData.texture.height)
+        };
+        RegisterSharedTexture(textureData, load.sourcePath, load.path, load.sceneIdentity, 1);
+        IndexTexture(load.name, textureData);
+        if (load.type == TextureType::Animated) CalculateFramePositions(textureData, load.sceneIdentity);
+        if (load.type == TextureType::Tiled) CalculateTileUVs(textureData);
+        sceneOwnedTextures[load.sceneIdentity].push_back(load.name);
+    } else if (fonts.contains(load.name)) {
+        // Loaded synchronously while this one was decoding, keep that one
+        ENGINE_LOG(LOG_WARNING, "Font '%s' is already loaded, dropping the async copy", load.name.data());
+        if (load.glyphs != nullptr) UnloadFontData(load.glyphs, load.glyphCount);
+        MemFree(load.recs);
     } else {
-        font = LoadFontEx(GetAssetPath(path).c_str(), 10, const_cast<int*>(codepoints.data()), static_cast<int>(codepoints.size()));
+        Font font{};
+        font.baseSize = load.fontSize;
+        font.glyphCount = load.glyphCount;
+        font.glyphPadding = FONT_GLYPH_PADDING;
+        font.texture = LoadTextureFromImage(load.image);
+        font.recs = load.recs;
+        font.glyphs = load.glyphs;
+        RegisterFont(load.name, font, load.sceneIdentity);
+    }
+
+    UnloadImage(load.image);
+    return true;
+}
+
+void AssetManager::SyncFrame(double uploadBudgetMs) noexcept {
+    WriteScope write;
+    currentFrame.fetch_add(1, std::memory_order_relaxed);
+    QueueReloads();
+    ProcessUploads(uploadBudgetMs);
+    ComposeStagedAtlases();
+    EnforceMemoryBudget();
+}
+
+void AssetManager::MarkUsed(const TextureData& textureData) noexcept {
+    Residency* residency = textureData.residency;
+    if (residency == nullptr) return;
+
+    residency->lastUsedFrame.store(currentFrame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    if (textureData.texture.id == 0) {
+        residency->reloadRequested.store(true, std::memory_order_relaxed);
+    }
+}
+
+void AssetManager::SetAliasTextures(std::string_view sourcePath, const Texture& texture) noexcept {
+    for (auto& textureData : textures | std::views::values) {
+        if (textureData.sourcePath == sourcePath) textureData.texture = texture;
+    }
+    lookupsDirty = true;
+}
+
+void AssetManager::QueueReloads() noexcept {
+    for (auto& [sourcePath, shared] : sharedTextures) {
+        Residency* residency = shared.residency.get();
+        if (residency == nullptr || residency->resident || residency->reloading) continue;
+        if (!residency->reloadRequested.exchange(false, std::memory_order_relaxed)) continue;
+
+        residency->reloading = true;
+        auto load = std::make_shared<AsyncLoad>();
+        load->kind = AsyncLoad::Kind::Reload;
+        load->path = shared.assetPath;
+        load->sourcePath = sourcePath;
+        load->sceneIdentity = shared.sceneIdentity;
+        load->type = TextureType::Single;
+        load->gridSize = Vector2Int{0, 0};
+        load->fontSize = 0;
+        QueueAsyncLoad(std::move(load));
     }
-    
-    std::string_view internedName = InternString(name);
-    fonts.emplace(internedName, std::move(font));
-    sceneOwnedFonts[sceneIdentity].push_back(internedName);
+}
+
+bool AssetManager::ReloadTexture(AsyncLoad& load) noexcept {
+    const auto it = sharedTextures.find(load.sourcePath);
+    Residency* residency = it != sharedTextures.end() ? it->second.residency.get() : nullptr;
+    // The owners may have unloaded while it was decoding
+    if (residency == nullptr || residency->resident || load.image.data == nullptr) {
+        if (residency != nullptr) residency->reloading = false;
+        if (load.image.data != nullptr) UnloadImage(load.image);
+        return false;
+    }
+
+    SharedTexture& shared = it->second;
+    shared.texture = LoadTextureFromImage(load.image);
+    UnloadImage(load.image);
+    residentTextureBytes += shared.bytes;
+    residency->resident = true;
+    residency->reloading = false;
+    SetAliasTextures(load.sourcePath, shared.texture);
+    ++reloadCount;
+    return true;
+}
+
+void AssetManager::EnforceMemoryBudget() noexcept {
+    if (memoryBudget == 0) return;
+
+    if (residentTextureBytes + residentAtlasBytes + residentFontBytes <= memoryBudget) return;
+
+    const u64 frame = currentFrame.load(std::memory_order_relaxed);
+    std::vector<std::pair<const std::string_view, SharedTexture>*> candidates;
+    for (auto& entry : sharedTextures) {
+        const Residency* residency = entry.second.residency.get();
+        if (residency == nullptr || !residency->resident) continue;
+        if (frame - residency->lastUsedFrame.load(std::memory_order_relaxed) <= EVICTION_GRACE_FRAMES) continue;
+        candidates.push_back(&entry);
+    }
+    std::ranges::sort(candidates, {}, [](const auto* entry) {
+        return entry->second.residency->lastUsedFrame.load(std::memory_order_relaxed);
+    });
+
+    for (auto* entry : candidates) {
+        if (residentTextureBytes + residentAtlasBytes + residentFontBytes <= memoryBudget) break;
+
+        auto& [sourcePath, shared] = *entry;
+        ::UnloadTexture(shared.texture);
+        shared.texture.id = 0;
+        shared.residency->resident = false;
+        shared.residency->reloadRequested.store(false, std::memory_order_relaxed);
+        SetAliasTextures(sourcePath, shared.texture);
+
+        residentTextureBytes -= shared.bytes;
+        ++evictionCount;
+        ENGINE_LOG(LOG_DEBUG, "Evicted %s (%llu KB)", shared.assetPath.c_str(), shared.bytes / 1024);
+    }
+}
+
+void AssetManager::SetMemoryBudget(u64 bytes) noexcept {
+    memoryBudget = bytes;
+}
+
+AssetManager::ResidencyReport AssetManager::GetResidencyReport() noexcept {
+    ResidencyReport report{};
+    report.budgetBytes = memoryBudget;
+    report.evictions = evictionCount;
+    report.reloads = reloadCount;
+    report.textureBytes = residentTextureBytes;
+    report.atlasBytes = residentAtlasBytes;
+    report.fontBytes = residentFontBytes;
+
+    for (const auto& shared : sharedTextures | std::views::values) {
+        if (shared.residency == nullptr) continue;
+        if (shared.residency->resident) {
+            ++report.residentTextures;
+        } else {
+            ++report.evictedTextures;
+        }
+    }
+
+    report.residentBytes = report.textureBytes + report.atlasBytes + report.fontBytes;
+    return report;
+}
+
+void AssetManager::ProcessUploads(double budgetMs) noexcept {
+    const auto start = std::chrono::steady_clock::now();
+
+    do {
+        std::shared_ptr<AsyncLoad> load;
+        {
+            std::lock_guard lock(decodedMutex);
+            if (decodedLoads.empty()) return;
+            load = std::move(decodedLoads.front());
+            decodedLoads.pop_front();
+        }
+        std::erase(inFlightLoads, load);
+
+        if (load->cancelled.load(std::memory_order_relaxed)) {
+            // The scene went away while decoding, only the CPU side needs freeing
+            if (load->image.data != nullptr) UnloadImage(load->image);
+            if (load->glyphs != nullptr) UnloadFontData(load->glyphs, load->glyphCount);
+            MemFree(load->recs);
+            load->promise.set_value(LoadState::Unknown);
+            SettleAliases(*load, LoadState::Unknown);
+            continue;
+        }
+
+        if (load->kind == AsyncLoad::Kind::Reload) {
+            load->promise.set_value(ReloadTexture(*load) ? LoadState::Loaded : LoadState::Failed);
+        } else if (StageAtlasLoad(load)) {
+            // Stays pending until ComposeStagedAtlases packs the scene's page
+        } else if (UploadAsyncLoad(*load)) {
+            // From here on the asset answers like a synchronously loaded one
+            asyncLoadStates.erase(load->name);
+            load->promise.set_value(LoadState::Loaded);
+            SettleAliases(*load, LoadState::Loaded);
+        } else {
+            asyncLoadStates[load->name] = LoadState::Failed;
+            load->promise.set_value(LoadState::Failed);
+            SettleAliases(*load, LoadState::Failed);
+        }
+    } while (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() < budgetMs);
+}
+
+bool AssetManager::StageAtlasLoad(const std::shared_ptr<AsyncLoad>& load) noexcept {
+    if (!load->atlas || load->kind != AsyncLoad::Kind::Texture || load->image.data == nullptr) return false;
+    if (load->image.width > atlas::MAX_ENTRY_SIZE || load->image.height > atlas::MAX_ENTRY_SIZE) return false;
+    // Already resident, UploadAsyncLoad aliases it
+    if (sharedTextures.contains(load->sourcePath)) return false;
+
+    stagedAtlasLoads[load->sceneIdentity].push_back(load);
+    return true;
+}
+
+void AssetManager::ComposeStagedAtlases() noexcept {
+    for (auto it = stagedAtlasLoads.begin(); it != stagedAtlasLoads.end();) {
+        const i32 sceneIdentity = it->first;
+        const bool decoding = std::ranges::any_of(inFlightLoads, [sceneIdentity](const auto& load) {
+            return load->sceneIdentity == sceneIdentity && load->atlas && !load->cancelled.load(std::memory_order_relaxed);
+        });
+        if (decoding) {
+            ++it;
+            continue;
+        }
+
+        // Same path as a synchronous Begin/End, only without touching the disk
+        const std::vector<std::shared_ptr<AsyncLoad>> staged = std::move(it->second);
+        it = stagedAtlasLoads.erase(it);
+        BeginSceneAtlas(sceneIdentity);
+        for (const auto& load : staged) {
+            AddSceneTexture(load->name, load->path, sceneIdentity, load->type, load->gridSize, load->image);
+            load->image = Image{};
+            // Found among the pending atlas entries by path, nothing is read
+            for (const auto& alias : load->aliases) {
+                AddSceneTexture(alias->name, alias->path, sceneIdentity, alias->type, alias->gridSize);
+            }
+        }
+        EndSceneAtlas(sceneIdentity);
+
+        for (const auto& load : staged) {
+            asyncLoadStates.erase(load->name);
+            load->promise.set_value(LoadState::Loaded);
+            for (const auto& alias : load->aliases) {
+                asyncLoadStates.erase(alias->name);
+                alias->promise.set_value(LoadState::Loaded);
+            }
+            load->aliases.clear();
+        }
+    }
+}
+
+void AssetManager::CancelSceneLoads(i32 sceneIdentity, AsyncLoad::Kind kind) noexcept {
+    for (const auto& load : inFlightLoads) {
+        if (load->sceneIdentity == sceneIdentity && load->kind == kind && !load->cancelled.exchange(true)) {
+            asyncLoadStates.erase(load->name);
+            for (const auto& alias : load->aliases) asyncLoadStates.erase(alias->name);
+        }
+    }
+
+    if (kind != AsyncLoad::Kind::Texture) return;
+    if (const auto it = stagedAtlasLoads.find(sceneIdentity); it != stagedAtlasLoads.end()) {
+        for (const auto& load : it->second) {
+            UnloadImage(load->image);
+            asyncLoadStates.erase(load->name);
+            load->promise.set_value(LoadState::Unknown);
+            SettleAliases(*load, LoadState::Unknown);
+        }
+        stagedAtlasLoads.erase(it);
+    }
+}
+
+AssetManager::LoadState AssetManager::GetLoadState(std::string_view name) noexcept {
+    if (const auto it = asyncLoadStates.find(name); it != asyncLoadStates.end()) {
+        return it->second;
+    }
+    // Synchronously loaded assets are ready as soon as they are registered
+    if (textureIndex.Find(AssetId(name)) || fontIndex.Find(AssetId(name))) {
+        return LoadState::Loaded;
+    }
+    return LoadState::Unknown;
+}
+
+bool AssetManager::IsSceneLoaded(i32 sceneIdentity) noexcept {
+    return std::ranges::none_of(inFlightLoads, [sceneIdentity](const auto& load) {
+        return load->sceneIdentity == sceneIdentity && !load->cancelled.load(std::memory_order_relaxed);
+    });
 }
 
 const Texture& AssetManager::GetTexture(std::string_view name) noexcept {
-    return textures.at(InternString(name)).texture;
+    return GetTexture(AssetId(name));
 }
 
 std::pair<const Texture&, Rectangle> AssetManager::GetTextureFrame(std::string_view name, const int frame) noexcept {
-    std::string_view internedName = InternString(name);
-    auto& textureData = textures.at(internedName);
+    return GetTextureFrame(AssetId(name), frame);
+}
+
+std::pair<const Texture&, Rectangle> AssetManager::GetTile(std::string_view name, int tileX, int tileY) noexcept {
+    return GetTile(AssetId(name), tileX, tileY);
+}
+
+const AssetManager::TextureData& AssetManager::GetTextureData(std::string_view name) noexcept {
+    return GetTextureData(AssetId(name));
+}
+
+const Font& AssetManager::GetFont(std::string_view name) noexcept {
+    return GetFont(AssetId(name));
+}
+
+const Texture& AssetManager::GetTexture(AssetId id) noexcept {
+    return GetTextureData(id).texture;
+}
+
+std::pair<const Texture&, Rectangle> AssetManager::GetTextureFrame(AssetId id, const int frame) noexcept {
+    const auto& textureData = GetTextureData(id);
     
-    // Default source rectangle (entire texture)
-    Rectangle sourceRec = {
-        0.0f, 0.0f,
-        static_cast<float>(textureData.texture.width),
-        static_cast<float>(textureData.texture.height)
-    };
+    // Default source rectangle (entire image)
+    Rectangle sourceRec = textureData.region;
     
     // Check if this is an animated texture
-    if (textureData.type == TextureType::Animated && !textureData.framePositions.empty()) {
-        if (frame >= 0 && frame < textureData.framePositions.size()) {
-            sourceRec = textureData.framePositions[frame];
-        }
+    if (textureData.type == TextureType::Animated && frame >= 0 && static_cast<u32>(frame) < textureData.frames.count) {
+        sourceRec = GetFrameTable(textureData.frames.table)[textureData.frames.first + frame];
     }
     
     return {textureData.texture, sourceRec};
 }
 
-std::pair<const Texture&, Rectangle> AssetManager::GetTile(std::string_view name, int tileX, int tileY) noexcept {
-    std::string_view internedName = InternString(name);
-    auto& textureData = textures.at(internedName);
+std::pair<const Texture&, Rectangle> AssetManager::GetTile(AssetId id, int tileX, int tileY) noexcept {
+    const auto& textureData = GetTextureData(id);
     
-    // Default source rectangle (entire texture)
-    Rectangle sourceRec = {
-        0.0f, 0.0f,
-        static_cast<float>(textureData.texture.width),
-        static_cast<float>(textureData.texture.height)
-    };
+    // Default source rectangle (entire image)
+    Rectangle sourceRec = textureData.region;
     
     // Check if this is a tiled texture
-    if (textureData.type == TextureType::Tiled && !textureData.tilePositions.empty()) {
-        if (tileY >= 0 && tileY < textureData.tilePositions.size() && 
-            tileX >= 0 && tileX < textureData.tilePositions[tileY].size()) {
-            sourceRec = textureData.tilePositions[tileY][tileX];
-        }
+    if (textureData.type == TextureType::Tiled &&
+        tileX >= 0 && tileX < textureData.tileGrid.x &&
+        tileY >= 0 && tileY < textureData.tileGrid.y) {
+        const Vector2Int& tileSize = textureData.gridSize;
+        sourceRec = Rectangle{
+            textureData.region.x + static_cast<float>(tileX * tileSize.x),
+            textureData.region.y + static_cast<float>(tileY * tileSize.y),
+            static_cast<float>(tileSize.x),
+            static_cast<float>(tileSize.y)
+        };
     }
     
     return {textureData.texture, sourceRec};
 }
 
-const Font& AssetManager::GetFont(std::string_view name) noexcept {
-    return fonts.at(InternString(name));
+const AssetManager::TextureData& AssetManager::GetTextureData(AssetId id) noexcept {
+    if (TextureData* const* textureData = textureIndex.Find(id)) {
+        MarkUsed(**textureData);
+        return **textureData;
+    }
+    ENGINE_LOG(LOG_ERROR, "Texture %016llx is not loaded", id.value);
+    static const TextureData missing{};
+    return missing;
+}
+
+AssetManager::TextureHandle AssetManager::GetTextureHandle(AssetId id) noexcept {
+    TextureData* const* textureData = textureIndex.Find(id);
+    if (textureData == nullptr) {
+        ENGINE_LOG(LOG_ERROR, "Texture %016llx is not loaded", id.value);
+        return TextureHandle{};
+    }
+    return TextureHandle{id, (*textureData)->generation};
+}
+
+const Texture* AssetManager::TextureHandle::Resolve() const noexcept {
+    if (generation == 0) return nullptr;
+    TextureData* const* textureData = textureIndex.Find(id);
+    // Unloaded, or replaced by a newer texture under the same name
+    if (textureData == nullptr || (*textureData)->generation != generation) return nullptr;
+
+    MarkUsed(**textureData);
+    return (*textureData)->texture.id != 0 ? &(*textureData)->texture : nullptr;
+}
+
+const Font& AssetManager::GetFont(AssetId id) noexcept {
+    if (Font* const* font = fontIndex.Find(id)) {
+        return **font;
+    }
+    ENGINE_LOG(LOG_ERROR, "Font %016llx is not loaded", id.value);
+    static const Font missing{};
+    return missing;
 }
 
 void AssetManager::RemoveSceneTextures(i32 sceneIdentity) noexcept {
+    WriteScope write;
+    CancelSceneLoads(sceneIdentity, AsyncLoad::Kind::Texture);
+
     if (const auto it = sceneOwnedTextures.find(sceneIdentity); it != sceneOwnedTextures.end()) {
         for (const auto& textureName : it->second) {
             UnloadTexture(textureName);
@@ -204,22 +1314,60 @@ void AssetManager::RemoveSceneTextures(i32 sceneIdentity) noexcept {
         sceneOwnedTextures.erase(it);
     }
 
+    if (const auto it = sceneAtlasPages.find(sceneIdentity); it != sceneAtlasPages.end()) {
+        for (const auto& page : it->second) {
+            residentAtlasBytes -= TextureBytes(page);
+            ::UnloadTexture(page);
+        }
+        sceneAtlasPages.erase(it);
+    }
+    sceneFrameTables.erase(sceneIdentity);
+
     RemoveSceneFonts(sceneIdentity);
 }
 
+std::span<const Rectangle> AssetManager::GetFrameTable(i32 sceneIdentity) noexcept {
+    const auto it = sceneFrameTables.find(sceneIdentity);
+    if (it == sceneFrameTables.end()) return {};
+    return it->second;
+}
+
+void AssetManager::DropReplacedTexture(std::string_view name) noexcept {
+    if (!textures.contains(name)) return;
+
+    ENGINE_LOG(LOG_WARNING, "Texture '%s' is already loaded, replacing it", name.data());
+    const FrameRange frames = textures.at(name).frames;
+    UnloadTexture(name);
+    ReleaseFrames(frames);
+    for (auto& names : sceneOwnedTextures | std::views::values) {
+        std::erase(names, name);
+    }
+}
+
 void AssetManager::UnloadTexture(std::string_view name) noexcept {
-    const Texture& texture = GetTexture(name);
-    ::UnloadTexture(texture);
+    const auto& textureData = textures.at(InternString(name));
+    ReleaseSharedTexture(textureData);
+    textureIndex.Erase(AssetId(name));
     textures.erase(InternString(name));
+    lookupsDirty = true;
 }
 
 void AssetManager::UnloadFont(std::string_view name) noexcept {
     const Font& font = GetFont(name);
-    ::UnloadFont(font);
+    // Cached layouts point into the font's glyph tables
+    render::ClearTextLayoutCache();
+    // ReadScopes may still hold the glyph tables, freed once the next snapshot is out
+    retiringFonts.push_back(font);
+    residentFontBytes -= FontBytes(font);
+    fontIndex.Erase(AssetId(name));
     fonts.erase(InternString(name));
+    lookupsDirty = true;
 }
 
 void AssetManager::RemoveSceneFonts(i32 sceneIdentity) noexcept {
+    WriteScope write;
+    CancelSceneLoads(sceneIdentity, AsyncLoad::Kind::Font);
+
     if (const auto it = sceneOwnedFonts.find(sceneIdentity); it != sceneOwnedFonts.end()) {
         for (const auto& fontName : it->second) {
             UnloadFont(fontName);
@@ -10,8 +10,17 @@
 #include <string_view>
 #include <unordered_set>
 #include <memory>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <span>
 
+#include "AssetId.h"
+#include "AssetPack.h"
 #include "Defines.h"
+#include "EpochDomain.h"
 #include "raylib.h"
 
 class AssetManager {
@@ -22,14 +31,159 @@ public:
         Tiled       // Tiled texture
     };
 
+    // Normalized texture coordinates of one tile
+    struct TileUV {
+        float u0, v0, u1, v1;
+    };
+
+    // Frames of one animated texture: a slice of its scene's frame table (see GetFrameTable)
+    struct FrameRange {
+        i32 table = 0;      // Scene identity owning the table
+        u32 first = 0;
+        u32 count = 0;
+    };
+
+    // Eviction state of a standalone texture, shared by every name aliasing it
+    struct Residency {
+        std::atomic<u64> lastUsedFrame{0};
+        std::atomic<bool> reloadRequested{false};
+        bool resident = true;       // Main thread only
+        bool reloading = false;
+    };
+
     struct TextureData {
-        Texture texture;
+        Texture texture{};      // id is 0 while evicted
+        TextureType type = TextureType::Single;
+        Vector2Int gridSize{0, 0};
+        FrameRange frames{};                // Animated textures only
+        Vector2Int tileGrid{0, 0};          // Columns and rows of a tiled texture
+        std::vector<TileUV> tileUVs{};      // Row-major, index = row * tileGrid.x + column
+        Rectangle region{};     // Area of `texture` holding this image (whole texture unless atlased)
+        bool atlased = false;   // Texture is a shared atlas page owned by the scene
+        std::string_view sourcePath{};  // Canonical path of the shared image, empty if not shared
+        Residency* residency = nullptr; // Null for textures that are never evicted
+        u32 generation = 0;     // New each time the name is registered, see TextureHandle
+    };
+
+    // Reference to a texture that survives eviction. Resolving goes through the texture table and
+    // marks the texture as used; an evicted texture starts reloading and resolves to null until it
+    // is back. A handle taken before its name was replaced or unloaded resolves to null for good.
+    // Resolve reads the live table, so like GetTexture it is for the main and simulation threads.
+    class TextureHandle {
+    public:
+        TextureHandle() = default;
+
+        bool IsValid() const { return generation != 0; }
+        DLLEX const Texture* Resolve() const noexcept;
+
+    private:
+        friend class AssetManager;
+        TextureHandle(AssetId id, u32 generation) : id{id}, generation{generation} {}
+
+        AssetId id;
+        u32 generation = 0;
+    };
+
+private:
+    struct LookupSnapshot;
+
+public:
+    // Copy of a texture entry as published to ReadScope; never changes once published
+    struct TextureView {
+        Texture texture;        // id is 0 while evicted
         TextureType type;
         Vector2Int gridSize;
-        std::vector<Rectangle> framePositions;
-        std::vector<std::vector<Rectangle>> tilePositions;
+        Vector2Int tileGrid;
+        Rectangle region;
+        std::span<const Rectangle> framePositions;
+        FrameRange frames;      // Same frames, in the scene's GetFrameTable
+        u32 generation;         // Changes when the name is replaced, see TextureData
     };
 
+    // Lock-free lookups for threads that run alongside the main thread (AsyncUpdate, workers).
+    // Pins the snapshot published last; what it returns stays valid until the scope ends even
+    // if the asset is unloaded meanwhile. Keep scopes short, they hold back reclamation.
+    // These Find* calls are the only lookups safe on such threads: every other getter,
+    // GetTextureHandle, TextureHandle::Resolve and GetFrameTable included, reads the live tables
+    // that writers change without synchronization.
+    class ReadScope {
+    public:
+        DLLEX ReadScope() noexcept;
+        DLLEX ~ReadScope();
+
+        ReadScope(const ReadScope&) = delete;
+        ReadScope& operator=(const ReadScope&) = delete;
+
+        DLLEX const TextureView* FindTexture(AssetId id) const noexcept;
+        DLLEX TextureHandle FindTextureHandle(AssetId id) const noexcept;    // Of the texture FindTexture returns
+        DLLEX const Font* FindFont(AssetId id) const noexcept;
+        DLLEX u64 Version() const noexcept;    // Bumped by every published change
+
+    private:
+        const LookupSnapshot* snapshot;
+    };
+
+    struct ResidencyReport {
+        u64 budgetBytes;        // 0 when unlimited
+        u64 residentBytes;      // Sum of the three below
+        u64 textureBytes;       // Standalone textures currently on the GPU
+        u64 atlasBytes;
+        u64 fontBytes;
+        u32 residentTextures;
+        u32 evictedTextures;
+        u64 evictions;          // Totals since startup
+        u64 reloads;
+    };
+
+    // One asset of a scene's manifest, see PreloadManifest/LoadManifest
+    struct ManifestEntry {
+        enum class Kind : u8 { Texture, Font };
+
+        Kind kind;
+        std::string_view name;
+        std::string_view path;
+        TextureType type = TextureType::Single;
+        Vector2Int gridSize = {0, 0};   // Frame or tile size
+        int fontSize = 0;
+        bool atlas = false;     // Packed into the scene's atlas pages
+        bool streamed = false;  // LoadManifest queues it instead of waiting; poll GetLoadState
+
+        static constexpr ManifestEntry SingleTexture(std::string_view name, std::string_view path) {
+            return {Kind::Texture, name, path, TextureType::Single, {0, 0}, 0, false, false};
+        }
+        static constexpr ManifestEntry AtlasedTexture(std::string_view name, std::string_view path) {
+            return {Kind::Texture, name, path, TextureType::Single, {0, 0}, 0, true, false};
+        }
+        static constexpr ManifestEntry AnimatedTexture(std::string_view name, std::string_view path, Vector2Int frameSize) {
+            return {Kind::Texture, name, path, TextureType::Animated, frameSize, 0, false, false};
+        }
+        static constexpr ManifestEntry AtlasedAnimatedTexture(std::string_view name, std::string_view path, Vector2Int frameSize) {
+            return {Kind::Texture, name, path, TextureType::Animated, frameSize, 0, true, false};
+        }
+        static constexpr ManifestEntry TiledTexture(std::string_view name, std::string_view path, Vector2Int tileSize) {
+            return {Kind::Texture, name, path, TextureType::Tiled, tileSize, 0, false, false};
+        }
+        static constexpr ManifestEntry StreamedTiles(std::string_view name, std::string_view path, Vector2Int tileSize) {
+            return {Kind::Texture, name, path, TextureType::Tiled, tileSize, 0, false, true};
+        }
+        static constexpr ManifestEntry TextFont(std::string_view name, std::string_view path, int fontSize = 0) {
+            return {Kind::Font, name, path, TextureType::Single, {0, 0}, fontSize, false, false};
+        }
+    };
+
+    enum class LoadState : u8 {
+        Unknown,    // Never requested, or removed together with its scene
+        Pending,    // Decoding on a worker thread or waiting for its GPU upload
+        Loaded,
+        Failed
+    };
+
+    static constexpr const char* ASSET_PACK_FILE = "assets.pak";
+
+    // Serves every later load from the archive instead of loose files under assets/.
+    // Call before loading anything; files missing from the archive still load from disk.
+    DLLEX static bool MountPack(const std::string& file = ASSET_PACK_FILE) noexcept;
+
     // Texture management
     DLLEX static void AddSceneTexture(std::string_view name, std::string_view path, i32 sceneIdentity) noexcept;
     DLLEX static void AddSceneAnimatedTexture(std::string_view name, std::string_view path, i32 sceneIdentity, Vector2Int gridSquareSize) noexcept;
@@ -37,30 +191,248 @@ public:
     DLLEX static const Texture& GetTexture(std::string_view name) noexcept;
     DLLEX static std::pair<const Texture&, Rectangle> GetTextureFrame(std::string_view name, int frame) noexcept;
     DLLEX static std::pair<const Texture&, Rectangle> GetTile(std::string_view name, int tileX, int tileY) noexcept;
+    DLLEX static const TextureData& GetTextureData(std::string_view name) noexcept;
     DLLEX static void RemoveSceneTextures(i32 sceneIdentity) noexcept;
 
-    // Font management
+    // Source rectangles of every animated texture in the scene, atlased or not, back to back.
+    // Index with TextureData::frames. Aliases of one image share a slice, and a replaced texture's
+    // slice is compacted away. Invalidated when the scene adds, replaces or removes textures.
+    // Live table, main and simulation threads only; elsewhere use ReadScope's framePositions.
+    DLLEX static std::span<const Rectangle> GetFrameTable(i32 sceneIdentity) noexcept;
+
+    // Atlas batching. Small textures added between Begin/End are packed into shared pages,
+    // so they only become available through GetTexture/GetTextureFrame after EndSceneAtlas.
+    DLLEX static void BeginSceneAtlas(i32 sceneIdentity) noexcept;
+    DLLEX static void EndSceneAtlas(i32 sceneIdentity) noexcept;
+
+    // Font management. A subset baked by the font_baker build step at the same size is loaded
+    // in place of the TTF; AddSceneFontWithCodepoints always rasterizes.
     DLLEX static void AddSceneFont(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize = 0) noexcept;
     DLLEX static void AddSceneFontWithCodepoints(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize, const std::vector<int>& codepoints) noexcept;
     DLLEX static const Font& GetFont(std::string_view name) noexcept;
     DLLEX static void RemoveSceneFonts(i32 sceneIdentity) noexcept;
 
+    // Hashed lookups for hot paths: one probe, no allocation. The string_view getters
+    // above hash at runtime and forward here. Like the rest of the API these are for the main
+    // and simulation threads; other threads use ReadScope.
+    DLLEX static const Texture& GetTexture(AssetId id) noexcept;
+    DLLEX static std::pair<const Texture&, Rectangle> GetTextureFrame(AssetId id, int frame) noexcept;
+    DLLEX static std::pair<const Texture&, Rectangle> GetTile(AssetId id, int tileX, int tileY) noexcept;
+    DLLEX static const TextureData& GetTextureData(AssetId id) noexcept;
+    DLLEX static const Font& GetFont(AssetId id) noexcept;
+    DLLEX static TextureHandle GetTextureHandle(AssetId id) noexcept;
+
+    // Memory budget. When the resident total goes over it, standalone textures unused for
+    // EVICTION_GRACE_FRAMES are evicted least recently used first and reload on their next
+    // use. Atlas pages and fonts stay until their scene unloads but count towards the total.
+    DLLEX static void SetMemoryBudget(u64 bytes) noexcept;     // 0 disables eviction
+    DLLEX static ResidencyReport GetResidencyReport() noexcept;
+
+    // Async loading. Files are decoded on the engine's worker threads and uploaded to the GPU
+    // by SyncFrame on the main thread, so the asset is usable from the frame after the
+    // future resolves. Never block on the future from the main thread; the upload would not run.
+    // Async textures are never atlased, and async fonts must be TTF/OTF.
+    DLLEX static std::shared_future<LoadState> AddSceneTextureAsync(std::string_view name, std::string_view path, i32 sceneIdentity,
+                                                                    TextureType type = TextureType::Single, Vector2Int gridSize = {0, 0}) noexcept;
+    DLLEX static std::shared_future<LoadState> AddSceneFontAsync(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize = 0) noexcept;
+    DLLEX static LoadState GetLoadState(std::string_view name) noexcept;
+    DLLEX static bool IsSceneLoaded(i32 sceneIdentity) noexcept;
+
+    // Scene manifests. PreloadManifest streams a scene's assets on the workers while another
+    // scene runs, atlas entries included; LoadManifest, called from the scene's Load, then only
+    // activates them. Whatever was not preloaded is loaded there, and whatever is still decoding
+    // is waited for, except streamed entries. Fonts must be TTF/OTF to preload.
+    DLLEX static void PreloadManifest(std::span<const ManifestEntry> manifest, i32 sceneIdentity) noexcept;
+    DLLEX static void LoadManifest(std::span<const ManifestEntry> manifest, i32 sceneIdentity) noexcept;
+
+    // Main-thread frame hook, run while the simulation is paused: queues reloads of evicted
+    // textures, uploads decoded assets, enforces the memory budget and publishes the result to ReadScope.
+    DLLEX static void SyncFrame(double uploadBudgetMs) noexcept;
+
 private:
+    static constexpr i32 NO_ATLAS_SCENE = -1;
+    // Long enough that no snapshot in flight still draws an evicted texture
+    static constexpr u64 EVICTION_GRACE_FRAMES = 120;
+    static constexpr const char* ATLAS_CACHE_DIRECTORY = "cache/";
+
+    struct PendingAtlasEntry {
+        std::string_view name;
+        std::string path;
+        Image image;
+        std::string_view sourcePath;
+    };
+
+    // Another name for an image already waiting in pendingAtlasEntries
+    struct PendingAtlasAlias {
+        std::string_view name;
+        size_t entry;
+    };
+
+    // One GPU texture per canonical path, referenced by every name that aliases it
+    struct SharedTexture {
+        Texture texture;
+        Rectangle region;
+        bool atlased;
+        i32 sceneIdentity;      // Owner of the atlas page, atlased images can't outlive it
+        u32 refCount;
+        std::string assetPath;  // Reload source after an eviction
+        u64 bytes;
+        std::unique_ptr<Residency> residency;   // Null for atlased images
+    };
+
+    // Immutable lookup tables behind ReadScope. Writers serialize on writeMutex, copy the
+    // live maps into a new snapshot and swap it in; the old one is freed by lookupEpochs.
+    struct LookupSnapshot {
+        u64 version;
+        AssetIdMap<TextureView> textures;
+        AssetIdMap<Font> fonts;
+        std::vector<Rectangle> framePositions;  // Backing store of every TextureView's frames
+    };
+
+    // Held by every public entry point that mutates assets; the outermost one publishes
+    class WriteScope {
+    public:
+        WriteScope();
+        ~WriteScope();
+
+        WriteScope(const WriteScope&) = delete;
+        WriteScope& operator=(const WriteScope&) = delete;
+    };
+
+    // raylib's LoadFont defaults for TTF files
+    static constexpr int DEFAULT_FONT_SIZE = 32;
+    static constexpr int DEFAULT_FONT_GLYPHS = 95;
+    static constexpr int FONT_GLYPH_PADDING = 4;
+
+    struct AsyncLoad {
+        enum class Kind : u8 { Texture, Font, Reload };
+
+        Kind kind;
+        std::string_view name;
+        std::string path;
+        std::string_view sourcePath;
+        i32 sceneIdentity;
+        TextureType type;
+        Vector2Int gridSize;
+        int fontSize;
+        bool atlas = false;     // Staged for the scene's atlas instead of uploaded on its own
+        bool streamed = false;  // LoadManifest does not wait for it
+
+        // Filled in by the worker
+        Image image{};
+        GlyphInfo* glyphs = nullptr;
+        Rectangle* recs = nullptr;
+        int glyphCount = 0;
+
+        std::atomic<bool> cancelled{false};
+        std::promise<LoadState> promise;
+        std::shared_future<LoadState> future;   // Also handed to later requests for the same name
+        std::vector<std::shared_ptr<AsyncLoad>> aliases;    // Other names for this file, settled with it
+    };
+
+    // `decoded` is consumed when given, so the file isn't read again
+    static void AddSceneTexture(std::string_view name, std::string_view path, i32 sceneIdentity, TextureType type, Vector2Int gridSize,
+                                Image decoded = Image{}) noexcept;
+    static std::shared_ptr<AsyncLoad> MakeTextureLoad(std::string_view name, std::string_view path, i32 sceneIdentity,
+                                                      TextureType type, Vector2Int gridSize) noexcept;
+    static std::shared_ptr<AsyncLoad> MakeFontLoad(std::string_view name, std::string_view path, i32 sceneIdentity, int fontSize) noexcept;
+    // Loads of the same name are merged, the later request gets the pending one's future. Loads
+    // of a file that is already decoding become aliases, so each path is decoded once.
+    static std::shared_future<LoadState> QueueAsyncLoad(std::shared_ptr<AsyncLoad> load) noexcept;
+    static void SettleAliases(AsyncLoad& load, LoadState state) noexcept;
+    static std::shared_ptr<AsyncLoad> FindPendingLoad(const std::function<bool(const AsyncLoad&)>& match) noexcept;
+    static void DecodeAsyncLoad(AsyncLoad& load) noexcept;
+    static bool UploadAsyncLoad(AsyncLoad& load) noexcept;
+    static void CancelSceneLoads(i32 sceneIdentity, AsyncLoad::Kind kind) noexcept;
+    static void ProcessUploads(double budgetMs) noexcept;
+    static bool StageAtlasLoad(const std::shared_ptr<AsyncLoad>& load) noexcept;
+    static void ComposeStagedAtlases() noexcept;
+    static void FinishSceneLoads(i32 sceneIdentity) noexcept;
+    static bool IsRegistered(const ManifestEntry& entry) noexcept;
+
+    // Residency
+    static void MarkUsed(const TextureData& textureData) noexcept;
+    static bool ReloadTexture(AsyncLoad& load) noexcept;
+    static void QueueReloads() noexcept;
+    static void EnforceMemoryBudget() noexcept;
+    static void SetAliasTextures(std::string_view sourcePath, const Texture& texture) noexcept;
     static void UnloadTexture(std::string_view name) noexcept;
+    // Unloads the texture a new load of `name` replaces and removes it from its scene's list
+    static void DropReplacedTexture(std::string_view name) noexcept;
+    static bool ShareTexture(TextureData& textureData, std::string_view sourcePath, i32 sceneIdentity) noexcept;
+    static void RegisterSharedTexture(TextureData& textureData, std::string_view sourcePath, std::string_view assetPath,
+                                      i32 sceneIdentity, u32 references) noexcept;
+    static void ReleaseSharedTexture(const TextureData& textureData) noexcept;
+    static std::string_view CanonicalPath(std::string_view path) noexcept;
     static void UnloadFont(std::string_view name) noexcept;
-    static void CalculateFramePositions(std::string_view name, const Texture& texture, const Vector2Int& gridSize) noexcept;
-    static void CalculateTilePositions(std::string_view name, const Texture& texture, const Vector2Int& tileSize) noexcept;
+    static void CalculateFramePositions(TextureData& textureData, i32 sceneIdentity) noexcept;
+    static void ReleaseFrames(FrameRange frames) noexcept;
+    static void CalculateTileUVs(TextureData& textureData) noexcept;
     static std::string GetAssetPath(std::string_view path) noexcept;
+    static std::span<const u8> FindPacked(std::string_view path) noexcept;
+    static Image LoadAssetImage(std::string_view path) noexcept;
+    static Font LoadAssetFont(std::string_view path, int fontSize, int* codepoints, int codepointCount) noexcept;
+    static bool LoadBakedFont(std::string_view path, int fontSize, Font& font, Image& atlas) noexcept;
+    static void RegisterFont(std::string_view name, Font font, i32 sceneIdentity) noexcept;
     static std::string_view InternString(std::string_view str) noexcept;
+    static void IndexTexture(std::string_view name, TextureData& textureData) noexcept;
+    static void IndexFont(std::string_view name, Font& font) noexcept;
+    static void CheckAssetId(std::string_view name) noexcept;
+    static void PublishLookups() noexcept;
+
+    static pack::Archive assetPack;
 
     // Texture management
     static std::unordered_map<std::string_view, TextureData> textures;
     static std::unordered_map<i32, std::vector<std::string_view>> sceneOwnedTextures;
+    static std::unordered_map<std::string_view, SharedTexture> sharedTextures;
+
+    // Atlas management
+    static std::unordered_map<i32, std::vector<Texture>> sceneAtlasPages;
+    static std::unordered_map<i32, std::vector<Rectangle>> sceneFrameTables;
+    static std::vector<PendingAtlasEntry> pendingAtlasEntries;
+    static std::vector<PendingAtlasAlias> pendingAtlasAliases;
+    static i32 atlasSceneIdentity;
 
     // Font management
     static std::unordered_map<std::string_view, Font> fonts;
     static std::unordered_map<i32, std::vector<std::string_view>> sceneOwnedFonts;
 
+    // Residency
+    static std::atomic<u64> currentFrame;
+    static u64 memoryBudget;
+    static u64 evictionCount;
+    static u64 reloadCount;
+    // Kept up to date on load, unload, eviction and reload so the budget check doesn't walk every asset
+    static u64 residentTextureBytes;
+    static u64 residentAtlasBytes;
+    static u64 residentFontBytes;
+    static u32 textureGeneration;
+
+    // Async loading. inFlightLoads and asyncLoadStates are main-thread only,
+    // decodedLoads is the hand-off from the workers.
+    static std::vector<std::shared_ptr<AsyncLoad>> inFlightLoads;
+    static std::unordered_map<std::string_view, LoadState> asyncLoadStates;
+    static std::deque<std::shared_ptr<AsyncLoad>> decodedLoads;
+    static std::mutex decodedMutex;
+    // Decoded atlas images held until the scene's last one arrives, then packed together
+    static std::unordered_map<i32, std::vector<std::shared_ptr<AsyncLoad>>> stagedAtlasLoads;
+
+    // Hashed indices into textures/fonts; the node-based maps keep the pointers stable
+    static AssetIdMap<TextureData*> textureIndex;
+    static AssetIdMap<Font*> fontIndex;
+#if GDEBUG
+    static std::unordered_map<u64, std::string_view> assetIdNames;
+#endif
+
+    // Snapshot publication
+    static std::recursive_mutex writeMutex;
+    static u32 writeDepth;
+    static bool lookupsDirty;
+    static std::atomic<const LookupSnapshot*> lookupSnapshot;
+    static std::vector<Font> retiringFonts;     // Unloaded once the snapshots showing them are gone
+    static EpochDomain lookupEpochs;
+
     // String interning
     static std::unordered_set<std::string> stringPool;
 };
@@ -0,0 +1,214 @@
+#include "AssetPack.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#ifdef GPLATFORM_WINDOWS
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace pack {
+    namespace {
+        u64 AlignUp(u64 value) {
+            return (value + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+        }
+
+        void WritePadding(std::ofstream& out, u64 from, u64 to) {
+            static constexpr char zeros[DATA_ALIGNMENT] = {};
+            out.write(zeros, static_cast<std::streamsize>(to - from));
+        }
+    }
+
+    Archive::~Archive() {
+        Close();
+    }
+
+    bool Archive::Open(const std::string& file) noexcept {
+        Close();
+
+        std::error_code error;
+        const auto writeTime = std::filesystem::last_write_time(file, error);
+        if (error) return false;
+
+#ifdef GPLATFORM_WINDOWS
+        HANDLE handle = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (handle == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER fileSize{};
+        GetFileSizeEx(handle, &fileSize);
+        HANDLE mapping = fileSize.QuadPart > 0 ? CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+        CloseHandle(handle);
+        if (mapping == nullptr) return false;
+
+        base = static_cast<const u8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (base == nullptr) {
+            CloseHandle(mapping);
+            return false;
+        }
+        mappingHandle = mapping;
+        size = static_cast<size_t>(fileSize.QuadPart);
+#else
+        const int descriptor = open(file.c_str(), O_RDONLY);
+        if (descriptor < 0) return false;
+
+        struct stat info{};
+        void* mapped = MAP_FAILED;
+        if (fstat(descriptor, &info) == 0 && info.st_size > 0) {
+            mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        }
+        // The mapping stays valid after the descriptor is closed
+        close(descriptor);
+        if (mapped == MAP_FAILED) return false;
+
+        base = static_cast<const u8*>(mapped);
+        size = static_cast<size_t>(info.st_size);
+#endif
+
+        // Validate everything up front so Find can trust the index
+        const auto* header = reinterpret_cast<const Header*>(base);
+        const u64 indexEnd = sizeof(Header) + static_cast<u64>(size >= sizeof(Header) ? header->entryCount : 0) * sizeof(Entry);
+        if (size < sizeof(Header) || header->magic != MAGIC || header->version != VERSION || indexEnd > size) {
+            Close();
+            return false;
+        }
+
+        entries = reinterpret_cast<const Entry*>(base + sizeof(Header));
+        entryCount = header->entryCount;
+        for (u32 i = 0; i < entryCount; ++i) {
+            const Entry& entry = entries[i];
+            if (static_cast<u64>(entry.pathOffset) + entry.pathLength > size ||
+                entry.dataOffset > size || entry.dataSize > size - entry.dataOffset ||
+                (i > 0 && PathOf(entries[i - 1]) >= PathOf(entry))) {
+                Close();
+                return false;
+            }
+        }
+        modifiedTime = static_cast<u64>(writeTime.time_since_epoch().count());
+        return true;
+    }
+
+    void Archive::Close() noexcept {
+        if (base == nullptr) return;
+
+#ifdef GPLATFORM_WINDOWS
+        UnmapViewOfFile(base);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        mappingHandle = nullptr;
+#else
+        munmap(const_cast<u8*>(base), size);
+#endif
+        base = nullptr;
+        size = 0;
+        entries = nullptr;
+        entryCount = 0;
+        modifiedTime = 0;
+    }
+
+    std::string_view Archive::PathOf(const Entry& entry) const {
+        return {reinterpret_cast<const char*>(base + entry.pathOffset), entry.pathLength};
+    }
+
+    std::span<const u8> Archive::Find(std::string_view path) const noexcept {
+        if (base == nullptr) return {};
+
+        const Entry* end = entries + entryCount;
+        const Entry* it = std::lower_bound(entries, end, path, [this](const Entry& entry, std::string_view value) {
+            return PathOf(entry) < value;
+        });
+        if (it == end || PathOf(*it) != path) return {};
+        return {base + it->dataOffset, static_cast<size_t>(it->dataSize)};
+    }
+
+    u64 Archive::StampOf(std::span<const u8> data) const noexcept {
+        const u64 offset = static_cast<u64>(data.data() - base);
+        return modifiedTime ^ (offset * 0x9E3779B97F4A7C15ull);
+    }
+
+    bool Write(const std::vector<std::string>& directories, const std::string& file, std::string& error) noexcept {
+        namespace fs = std::filesystem;
+
+        std::error_code fsError;
+        std::vector<std::pair<std::string, fs::path>> files;
+        for (const std::string& directory : directories) {
+            for (fs::recursive_directory_iterator it(directory, fsError), end; !fsError && it != end; it.increment(fsError)) {
+                if (!it->is_regular_file()) continue;
+                files.emplace_back(fs::relative(it->path(), directory).generic_string(), it->path());
+            }
+            if (fsError) {
+                error = "cannot read " + directory + ": " + fsError.message();
+                return false;
+            }
+        }
+        std::ranges::sort(files, {}, &std::pair<std::string, fs::path>::first);
+
+        // Find's binary search needs every path once
+        const auto duplicate = std::ranges::adjacent_find(files, {}, &std::pair<std::string, fs::path>::first);
+        if (duplicate != files.end()) {
+            error = duplicate->first + " exists in more than one directory";
+            return false;
+        }
+
+        // Index first, paths next, then the data so each blob can be mapped aligned
+        std::vector<Entry> index(files.size());
+        u64 offset = sizeof(Header) + files.size() * sizeof(Entry);
+        for (size_t i = 0; i < files.size(); ++i) {
+            index[i].pathOffset = static_cast<u32>(offset);
+            index[i].pathLength = static_cast<u32>(files[i].first.size());
+            offset += files[i].first.size();
+        }
+        for (size_t i = 0; i < files.size(); ++i) {
+            offset = AlignUp(offset);
+            index[i].dataOffset = offset;
+            index[i].dataSize = static_cast<u64>(fs::file_size(files[i].second, fsError));
+            if (fsError) {
+                error = "cannot stat " + files[i].second.string();
+                return false;
+            }
+            offset += index[i].dataSize;
+        }
+
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            error = "cannot write " + file;
+            return false;
+        }
+
+        const Header header{MAGIC, VERSION, static_cast<u32>(files.size()), 0};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(Entry)));
+        u64 written = sizeof(Header) + index.size() * sizeof(Entry);
+        for (const auto& [path, source] : files) {
+            out.write(path.data(), static_cast<std::streamsize>(path.size()));
+            written += path.size();
+        }
+
+        std::vector<char> buffer;
+        for (size_t i = 0; i < files.size(); ++i) {
+            WritePadding(out, written, index[i].dataOffset);
+
+            std::ifstream in(files[i].second, std::ios::binary);
+            buffer.resize(index[i].dataSize);
+            if (!in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+                error = "cannot read " + files[i].second.string();
+                return false;
+            }
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            written = index[i].dataOffset + index[i].dataSize;
+        }
+
+        if (!out) {
+            error = "failed writing " + file;
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Defines.h"
+
+// Single-file asset archive. The whole file is memory mapped, and lookups hand out
+// views straight into the mapping, so loaders decode without an intermediate copy.
+//
+// Layout (little endian):
+//   Header  { magic 'PGPK', version, entryCount, reserved }
+//   Entry   [entryCount], sorted by path
+//   path strings, then file contents, each aligned to DATA_ALIGNMENT
+namespace pack {
+    constexpr u32 MAGIC = 0x4B504750; // "PGPK"
+    constexpr u32 VERSION = 1;
+    constexpr u64 DATA_ALIGNMENT = 16;
+
+    struct Header {
+        u32 magic;
+        u32 version;
+        u32 entryCount;
+        u32 reserved;
+    };
+
+    struct Entry {
+        u64 dataOffset;
+        u64 dataSize;
+        u32 pathOffset;
+        u32 pathLength;
+    };
+
+    class Archive {
+    public:
+        Archive() = default;
+        ~Archive();
+
+        Archive(const Archive&) = delete;
+        Archive& operator=(const Archive&) = delete;
+
+        DLLEX bool Open(const std::string& file) noexcept;
+        DLLEX void Close() noexcept;
+        bool IsOpen() const { return base != nullptr; }
+        u32 GetEntryCount() const { return entryCount; }
+
+        // Contents of the file stored under `path` (relative, '/' separated), or an empty span.
+        // Valid until Close. Safe to call from any thread while the archive stays open.
+        DLLEX std::span<const u8> Find(std::string_view path) const noexcept;
+
+        // Identifies a Find result without reading it: the entry's offset mixed with the pack
+        // file's modification time. Changes whenever the pack is rebuilt, for cache validation.
+        DLLEX u64 StampOf(std::span<const u8> data) const noexcept;
+
+    private:
+        std::string_view PathOf(const Entry& entry) const;
+
+        const u8* base = nullptr;
+        size_t size = 0;
+        const Entry* entries = nullptr;
+        u32 entryCount = 0;
+        u64 modifiedTime = 0;
+        void* mappingHandle = nullptr;  // Windows file mapping object
+    };
+
+    // Packs every regular file under `directories` into `file`, each stored relative to the
+    // directory it came from. A path found in two directories is an error. Used by the
+    // asset_packer build step.
+    DLLEX bool Write(const std::vector<std::string>& directories, const std::string& file, std::string& error) noexcept;
+}
+
+#endif //ASSETPACK_H
@@ -0,0 +1,45 @@
+#include "Culling.h"
+
+#include <algorithm>
+
+namespace render {
+    Rectangle GetCameraViewBounds(const Camera2D& camera, float width, float height) {
+        const Vector2 corners[4] = {
+            GetScreenToWorld2D(Vector2{0.0f, 0.0f}, camera),
+            GetScreenToWorld2D(Vector2{width, 0.0f}, camera),
+            GetScreenToWorld2D(Vector2{0.0f, height}, camera),
+            GetScreenToWorld2D(Vector2{width, height}, camera)
+        };
+
+        // A rotated camera sees a rotated rectangle, keep its bounding box
+        Vector2 min = corners[0];
+        Vector2 max = corners[0];
+        for (const Vector2& corner : corners) {
+            min.x = std::min(min.x, corner.x);
+            min.y = std::min(min.y, corner.y);
+            max.x = std::max(max.x, corner.x);
+            max.y = std::max(max.y, corner.y);
+        }
+        return Rectangle{min.x, min.y, max.x - min.x, max.y - min.y};
+    }
+
+    size_t CullBounds(const float* __restrict minX, const float* __restrict minY,
+                      const float* __restrict maxX, const float* __restrict maxY,
+                      size_t count, const Rectangle& view, u8* __restrict visible) {
+        const float left = view.x;
+        const float top = view.y;
+        const float right = view.x + view.width;
+        const float bottom = view.y + view.height;
+
+        for (size_t i = 0; i < count; ++i) {
+            visible[i] = static_cast<u8>((maxX[i] >= left) & (minX[i] <= right) &
+                                         (maxY[i] >= top) & (minY[i] <= bottom));
+        }
+
+        size_t visibleCount = 0;
+        for (size_t i = 0; i < count; ++i) {
+            visibleCount += visible[i];
+        }
+        return visibleCount;
+    }
+}
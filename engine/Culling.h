@@ -0,0 +1,19 @@
+#ifndef CULLING_H
+#define CULLING_H
+
+#include <cstddef>
+
+#include "Defines.h"
+#include "raylib.h"
+
+namespace render {
+    // World-space AABB seen by a 2D camera rendering into a width x height target
+    DLLEX Rectangle GetCameraViewBounds(const Camera2D& camera, float width, float height);
+
+    // Tests SoA bounds against the view. Writes 1/0 per entry into `visible` and returns
+    // how many are visible. Branch-free so the compiler can vectorize it.
+    DLLEX size_t CullBounds(const float* minX, const float* minY, const float* maxX, const float* maxY,
+                            size_t count, const Rectangle& view, u8* visible);
+}
+
+#endif //CULLING_H
@@ -10,10 +10,13 @@
 #include "Log.h"
 #include "Renderer.h"
 #include "Profiler.h"
+#include "KeyManager.h"
+#include "AssetManager.h"
 
 int Engine::framesBeforeProfiling = 60;
 Engine* Engine::instance = nullptr;
 std::atomic<bool> Engine::frameStatsEnabled{true};  // Enable by default
+bool Engine::pipelinedRendering = false;
 
 void Engine::SetProfilingEnabled(bool enabled, int framesBeforeProfiling) {
     Profiler::GetInstance().SetEnabled(enabled);
@@ -24,6 +27,20 @@ void Engine::SetFrameStatsEnabled(bool enabled) {
     frameStatsEnabled = enabled;
 }
 
+void Engine::SetPipelinedRendering(bool enabled) {
+    pipelinedRendering = enabled;
+}
+
+bool Engine::QueueWorkerTask(std::function<void()>&& task) {
+    if (instance == nullptr || !instance->isRunning || instance->shouldExit) return false;
+
+    std::lock_guard lock(instance->taskMutex);
+    if (instance->nonRenderingTasks.size() >= MAX_QUEUED_TASKS) return false;
+    instance->nonRenderingTasks.emplace(std::move(task));
+    instance->taskCondition.notify_one();
+    return true;
+}
+
 void Engine::UpdateTargetFPS() {
     PROFILE_SCOPE("UpdateTargetFPS");
     int currentMonitor = GetCurrentMonitor();
@@ -99,6 +116,51 @@ void Engine::ProcessFixedUpdates() {
     }
 }
 
+void Engine::ProcessSimulation() {
+    while (true) {
+        float deltaTime;
+        {
+            std::unique_lock<std::mutex> lock(simulationMutex);
+            simulationCondition.wait(lock, [this] {
+                return simulationRequested || shouldExit;
+            });
+            if (shouldExit) break;
+            deltaTime = simulationDeltaTime;
+        }
+
+        try {
+            PROFILE_SCOPE("GameUpdate");
+            game->Update(deltaTime);
+            game->PublishFrame();
+        } catch (const std::exception& e) {
+            ENGINE_LOG(LOG_ERROR, "Simulation update failed: %s", e.what());
+        }
+
+        {
+            std::lock_guard lock(simulationMutex);
+            simulationRequested = false;
+        }
+        simulationCondition.notify_all();
+    }
+}
+
+void Engine::RequestSimulation(float deltaTime) {
+    {
+        std::lock_guard lock(simulationMutex);
+        simulationDeltaTime = deltaTime;
+        simulationRequested = true;
+    }
+    simulationCondition.notify_all();
+}
+
+void Engine::WaitForSimulation() {
+    PROFILE_SCOPE("WaitForSimulation");
+    std::unique_lock<std::mutex> lock(simulationMutex);
+    simulationCondition.wait(lock, [this] {
+        return !simulationRequested || shouldExit;
+    });
+}
+
 void Engine::InitializeRenderer() {
     PROFILE_SCOPE("InitializeRenderer");
     render::Initialize();
@@ -119,6 +181,11 @@ void Engine::CleanupResources() {
     // Notify all threads
     taskCondition.notify_all();
     fixedUpdateCondition.notify_one();
+    {
+        // Taking the lock orders the exit flag before the simulation thread's predicate check
+        std::lock_guard lock(simulationMutex);
+    }
+    simulationCondition.notify_all();
     
     // Wait for all worker threads
     for (auto& thread : workerThreads) {
@@ -132,6 +199,10 @@ void Engine::CleanupResources() {
     if (fixedUpdateThread.joinable()) {
         fixedUpdateThread.join();
     }
+
+    if (simulationThread.joinable()) {
+        simulationThread.join();
+    }
     
     // Clear task queue
     std::queue<std::function<void()>>().swap(nonRenderingTasks);
@@ -176,6 +247,8 @@ void Engine::Start(int windowWidth, int windowHeight, const str& windowTitleL,
             fixedUpdateThread = std::thread(&Engine::ProcessFixedUpdates, this);
         }
 
+        AssetManager::MountPack();
+
         ENGINE_LOG(LOG_INFO, "Loading game...");
         {
             PROFILE_SCOPE("GameLoad");
@@ -183,9 +256,18 @@ void Engine::Start(int windowWidth, int windowHeight, const str& windowTitleL,
         }
         ENGINE_LOG(LOG_INFO, "Game loaded successfully");
 
+        // The GL context can't leave the main thread, so pipelining moves the simulation instead
+        const bool pipelined = pipelinedRendering && game->SupportsPipelining();
+        if (pipelined) {
+            key_manager::SetInputCaptureEnabled(true);
+            simulationThread = std::thread(&Engine::ProcessSimulation, this);
+            ENGINE_LOG(LOG_INFO, "Pipelined rendering enabled");
+        }
+
         ENGINE_LOG(LOG_DEBUG, "Starting main game loop");
 
         int lastMonitor = GetCurrentMonitor();
+        [[maybe_unused]] int captureCount = 0;
 
         while (!window.ShouldClose() && isRunning) {
             PROFILE_SCOPE("MainLoop");
@@ -207,6 +289,13 @@ void Engine::Start(int windowWidth, int windowHeight, const str& windowTitleL,
                 UpdateTargetFPS();
                 lastMonitor = currentMonitor;
             }
+
+            #if GDEBUG
+                // F9 dumps the next frame's render commands for tools/render_replay
+                if (IsKeyPressed(KEY_F9)) {
+                    render::CaptureNextFrame(TextFormat("captures/frame_%03d.rcap", captureCount++));
+                }
+            #endif
             
             // Update accumulator and notify fixed update thread
             {
@@ -225,9 +314,14 @@ void Engine::Start(int windowWidth, int windowHeight, const str& windowTitleL,
             });
 
             // Game update and rendering
-            {
+            if (pipelined) {
+                // Frame N simulates while frame N-1 is drawn from its published snapshot
+                key_manager::CaptureInput();
+                RequestSimulation(deltaTime);
+            } else {
                 PROFILE_SCOPE("GameUpdate");
                 game->Update(deltaTime);
+                game->PublishFrame();
             }
 
             {
@@ -238,6 +332,21 @@ void Engine::Start(int windowWidth, int windowHeight, const str& windowTitleL,
                 render::EndDraw();
             }
 
+            if (pipelined) {
+                WaitForSimulation();
+            }
+
+            // Both halves of the frame are idle here, so asset tables can change safely
+            {
+                PROFILE_SCOPE("AssetSync");
+                AssetManager::SyncFrame(ASSET_UPLOAD_BUDGET_MS);
+            }
+
+            {
+                PROFILE_SCOPE("GameSync");
+                game->SyncFrame();
+            }
+
             // Print frame stats
             if (frameStats.frameCount >= framesBeforeProfiling && frameStatsEnabled) {
                 float avgFrameTime = frameStats.frameTimeAccumulator / frameStats.frameCount;
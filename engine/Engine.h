@@ -38,9 +38,22 @@ public:
     // Enable or disable frame stats reporting
     DLLEX static void SetFrameStatsEnabled(bool enabled);
 
+    // Run Update on a simulation thread while the main thread renders the previous frame.
+    // Only takes effect for games that support it; must be set before Start.
+    DLLEX static void SetPipelinedRendering(bool enabled);
+
+    // Runs a task on the worker threads. Unlike the per-frame async update this never
+    // drops work; it returns false when the pool can't take it, so the caller runs it itself.
+    DLLEX static bool QueueWorkerTask(std::function<void()>&& task);
+
+    static constexpr double ASSET_UPLOAD_BUDGET_MS = 2.0;  // Main-thread GPU uploads per frame
+
 private:
     void ProcessNonRenderingTasks();
     void ProcessFixedUpdates();
+    void ProcessSimulation();
+    void RequestSimulation(float deltaTime);
+    void WaitForSimulation();
     void UpdateTargetFPS();
     void QueueAsyncTask(std::function<void()>&& task);
     void CleanupResources();
@@ -59,6 +72,13 @@ private:
     std::mutex fixedUpdateMutex;
     std::condition_variable fixedUpdateCondition;
 
+    // Simulation thread, only used with pipelined rendering
+    std::thread simulationThread;
+    std::mutex simulationMutex;
+    std::condition_variable simulationCondition;
+    bool simulationRequested = false;
+    float simulationDeltaTime = 0.0f;
+
     // Non-rendering tasks (worker threads)
     std::queue<std::function<void()>> nonRenderingTasks;
     std::mutex taskMutex;
@@ -78,6 +98,7 @@ private:
     static int framesBeforeProfiling;
     static Engine* instance;  // For monitor callback
     static std::atomic<bool> frameStatsEnabled;  // Control frame stats reporting
+    static bool pipelinedRendering;
 };
 
 #endif //ENGINE_H
@@ -0,0 +1,83 @@
+#include "EpochDomain.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace {
+    // Each thread owns one slot index, the same in every domain, until it exits
+    std::array<std::atomic<bool>, EpochDomain::MAX_THREADS> slotClaimed{};
+
+    struct ThreadSlot {
+        size_t index = 0;
+
+        ThreadSlot() {
+            for (;;) {
+                for (size_t i = 0; i < slotClaimed.size(); ++i) {
+                    bool expected = false;
+                    if (slotClaimed[i].compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                        index = i;
+                        return;
+                    }
+                }
+                // More live readers than slots, wait for a thread to exit
+                std::this_thread::yield();
+            }
+        }
+
+        ~ThreadSlot() {
+            slotClaimed[index].store(false, std::memory_order_release);
+        }
+    };
+
+    size_t CurrentThreadSlot() {
+        thread_local ThreadSlot slot;
+        return slot.index;
+    }
+}
+
+void EpochDomain::Enter() noexcept {
+    Slot& slot = slots[CurrentThreadSlot()];
+    if (slot.depth++ == 0) {
+        // seq_cst pairs with the writer's publish and scan, see Reclaim
+        slot.epoch.store(globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    }
+}
+
+void EpochDomain::Exit() noexcept {
+    Slot& slot = slots[CurrentThreadSlot()];
+    if (--slot.depth == 0) {
+        slot.epoch.store(0, std::memory_order_release);
+    }
+}
+
+void EpochDomain::Retire(std::function<void()> reclaim) {
+    // Readers that announce a later epoch started after the publish and can't see the old object
+    const u64 epoch = globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+    std::lock_guard lock(retiredMutex);
+    retired.push_back({epoch, std::move(reclaim)});
+}
+
+size_t EpochDomain::Reclaim() {
+    std::vector<Retired> ready;
+    {
+        std::lock_guard lock(retiredMutex);
+        if (retired.empty()) return 0;
+
+        u64 oldestReader = std::numeric_limits<u64>::max();
+        for (const Slot& slot : slots) {
+            const u64 epoch = slot.epoch.load(std::memory_order_seq_cst);
+            if (epoch != 0) oldestReader = std::min(oldestReader, epoch);
+        }
+
+        const auto split = std::stable_partition(retired.begin(), retired.end(), [oldestReader](const Retired& entry) {
+            return entry.epoch >= oldestReader;
+        });
+        ready.assign(std::make_move_iterator(split), std::make_move_iterator(retired.end()));
+        retired.erase(split, retired.end());
+    }
+
+    // Outside the lock, a callback may retire more work
+    for (auto& entry : ready) entry.reclaim();
+    return ready.size();
+}
@@ -0,0 +1,60 @@
+#ifndef EPOCHDOMAIN_H
+#define EPOCHDOMAIN_H
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "Defines.h"
+
+// Epoch-based reclamation for read-mostly data published through an atomic pointer.
+// Readers announce themselves with a ReadGuard and never block; writers retire the
+// objects they replaced, and Reclaim frees them once every reader that could still
+// see them has left.
+class EpochDomain {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+
+    class ReadGuard {
+    public:
+        explicit ReadGuard(EpochDomain& domain) : domain{domain} { domain.Enter(); }
+        ~ReadGuard() { domain.Exit(); }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+    private:
+        EpochDomain& domain;
+    };
+
+    // Guards nest; only the outermost one on a thread announces an epoch
+    DLLEX void Enter() noexcept;
+    DLLEX void Exit() noexcept;
+
+    // Call after the replacement has been published. `reclaim` runs on a later Reclaim call.
+    DLLEX void Retire(std::function<void()> reclaim);
+
+    // Runs every retired callback no reader can still observe. Returns how many ran.
+    DLLEX size_t Reclaim();
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<u64> epoch{0};  // 0 while the thread is outside any guard
+        u32 depth = 0;              // Owner thread only
+    };
+
+    struct Retired {
+        u64 epoch;
+        std::function<void()> reclaim;
+    };
+
+    std::atomic<u64> globalEpoch{1};
+    std::array<Slot, MAX_THREADS> slots;
+
+    std::mutex retiredMutex;
+    std::vector<Retired> retired;
+};
+
+#endif //EPOCHDOMAIN_H
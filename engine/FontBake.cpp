@@ -0,0 +1,77 @@
+#include "FontBake.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace font_bake {
+    bool Load(std::span<const u8> data, Font& font, Image& atlas) noexcept {
+        Header header{};
+        if (data.size() < sizeof(header)) return false;
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.magic != MAGIC || header.version != VERSION || header.glyphCount <= 0 ||
+            header.atlasWidth <= 0 || header.atlasHeight <= 0) {
+            return false;
+        }
+
+        const size_t glyphBytes = static_cast<size_t>(header.glyphCount) * sizeof(Glyph);
+        const int pixelBytes = GetPixelDataSize(header.atlasWidth, header.atlasHeight, header.atlasFormat);
+        if (pixelBytes <= 0 || data.size() != sizeof(header) + glyphBytes + static_cast<size_t>(pixelBytes)) return false;
+
+        auto* glyphs = static_cast<GlyphInfo*>(MemAlloc(static_cast<unsigned int>(header.glyphCount * sizeof(GlyphInfo))));
+        auto* recs = static_cast<Rectangle*>(MemAlloc(static_cast<unsigned int>(header.glyphCount * sizeof(Rectangle))));
+        void* pixels = MemAlloc(static_cast<unsigned int>(pixelBytes));
+        if (glyphs == nullptr || recs == nullptr || pixels == nullptr) {
+            MemFree(glyphs);
+            MemFree(recs);
+            MemFree(pixels);
+            return false;
+        }
+
+        const u8* cursor = data.data() + sizeof(header);
+        for (int i = 0; i < header.glyphCount; ++i, cursor += sizeof(Glyph)) {
+            Glyph glyph{};
+            std::memcpy(&glyph, cursor, sizeof(glyph));
+            glyphs[i] = GlyphInfo{glyph.value, glyph.offsetX, glyph.offsetY, glyph.advanceX, Image{}};
+            recs[i] = glyph.rec;
+        }
+        std::memcpy(pixels, cursor, static_cast<size_t>(pixelBytes));
+
+        font = Font{};
+        font.baseSize = header.fontSize;
+        font.glyphCount = header.glyphCount;
+        font.glyphPadding = header.glyphPadding;
+        font.recs = recs;
+        font.glyphs = glyphs;
+        atlas = Image{pixels, header.atlasWidth, header.atlasHeight, 1, header.atlasFormat};
+        return true;
+    }
+
+    bool Write(const std::string& file, int fontSize, int glyphPadding, const GlyphInfo* glyphs,
+               const Rectangle* recs, int glyphCount, const Image& atlas, std::string& error) noexcept {
+        const int pixelBytes = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+        if (glyphs == nullptr || recs == nullptr || atlas.data == nullptr || pixelBytes <= 0) {
+            error = "nothing to write for " + file;
+            return false;
+        }
+
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            error = "cannot write " + file;
+            return false;
+        }
+
+        const Header header{MAGIC, VERSION, fontSize, glyphCount, glyphPadding, atlas.width, atlas.height, atlas.format};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (int i = 0; i < glyphCount; ++i) {
+            const Glyph glyph{glyphs[i].value, glyphs[i].offsetX, glyphs[i].offsetY, glyphs[i].advanceX, recs[i]};
+            out.write(reinterpret_cast<const char*>(&glyph), sizeof(glyph));
+        }
+        out.write(static_cast<const char*>(atlas.data), pixelBytes);
+
+        if (!out) {
+            error = "failed writing " + file;
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef FONTBAKE_H
+#define FONTBAKE_H
+
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Defines.h"
+#include "raylib.h"
+
+// Pre-rasterized font subsets. The font_baker build step renders only the codepoints the
+// game uses into a glyph atlas and stores it with the metrics, so loading skips stb_truetype
+// entirely and the atlas only holds glyphs that are drawn.
+//
+// Layout (little endian):
+//   Header  { magic 'PGFB', version, fontSize, glyphCount, glyphPadding, atlas size and format }
+//   Glyph   [glyphCount], sorted by codepoint
+//   atlas pixels, GetPixelDataSize(atlasWidth, atlasHeight, atlasFormat) bytes
+namespace font_bake {
+    constexpr u32 MAGIC = 0x42464750; // "PGFB"
+    constexpr u32 VERSION = 1;
+
+    struct Header {
+        u32 magic;
+        u32 version;
+        i32 fontSize;
+        i32 glyphCount;
+        i32 glyphPadding;
+        i32 atlasWidth;
+        i32 atlasHeight;
+        i32 atlasFormat;
+    };
+
+    struct Glyph {
+        i32 value;
+        i32 offsetX;
+        i32 offsetY;
+        i32 advanceX;
+        Rectangle rec;
+    };
+
+    // Where the bake of `fontPath` at `fontSize` lives, relative to assets/
+    inline std::string BakedPath(std::string_view fontPath, int fontSize) {
+        return std::string(fontPath) + "." + std::to_string(fontSize) + ".glyphs";
+    }
+
+    // Fills glyphs, recs and metrics of `font` (glyph images stay empty, nothing draws from them)
+    // and returns the atlas in `atlas`; the caller uploads it to font.texture. Everything is
+    // allocated with MemAlloc, so UnloadFont/UnloadImage free it as usual.
+    DLLEX bool Load(std::span<const u8> data, Font& font, Image& atlas) noexcept;
+
+    // Used by the font_baker tool
+    DLLEX bool Write(const std::string& file, int fontSize, int glyphPadding, const GlyphInfo* glyphs,
+                     const Rectangle* recs, int glyphCount, const Image& atlas, std::string& error) noexcept;
+}
+
+#endif //FONTBAKE_H
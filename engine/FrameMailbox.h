@@ -0,0 +1,45 @@
+#ifndef FRAMEMAILBOX_H
+#define FRAMEMAILBOX_H
+
+#include <array>
+#include <atomic>
+
+#include "Defines.h"
+
+// Lock-free triple buffer handing whole frames from one producer thread to one consumer thread.
+// The producer never waits for the consumer; the consumer always sees the newest complete frame.
+template<typename T>
+class FrameMailbox {
+public:
+    // Producer: buffer to fill for the next frame
+    T& BeginWrite() { return buffers[writeIndex]; }
+
+    // Producer: hand the written buffer over, replacing any frame the consumer hasn't taken yet
+    void Publish() {
+        const u32 previous = ready.exchange(writeIndex | FRESH_BIT, std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    }
+
+    // Consumer: newest published frame, or the last one again if nothing new arrived.
+    // Null until the first Publish.
+    const T* AcquireLatest() {
+        if (ready.load(std::memory_order_acquire) & FRESH_BIT) {
+            const u32 previous = ready.exchange(readIndex, std::memory_order_acq_rel);
+            readIndex = previous & INDEX_MASK;
+            hasFrame = true;
+        }
+        return hasFrame ? &buffers[readIndex] : nullptr;
+    }
+
+private:
+    static constexpr u32 FRESH_BIT = 0x4;
+    static constexpr u32 INDEX_MASK = 0x3;
+
+    std::array<T, 3> buffers{};
+    u32 writeIndex = 0;             // Owned by the producer
+    std::atomic<u32> ready{1};      // Exchanged between both sides
+    u32 readIndex = 2;              // Owned by the consumer
+    bool hasFrame = false;
+};
+
+#endif //FRAMEMAILBOX_H
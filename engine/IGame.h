@@ -15,6 +15,13 @@ public:
     virtual void FixedUpdate(float fixed_d_time) = 0;
     virtual void AsyncUpdate(float d_time) = 0;  // This will run in worker threads
     virtual void Draw() = 0;
+
+    // Pipelined rendering: Update and PublishFrame run on the simulation thread while
+    // Draw renders the previously published frame on the main thread
+    virtual bool SupportsPipelining() const { return false; }
+    virtual void PublishFrame() {}
+    // Runs on the main thread once both halves of the frame are done
+    virtual void SyncFrame() {}
 };
 
 #endif //IGAME_H
@@ -4,14 +4,40 @@
 
 #include "KeyManager.h"
 
+#include <bitset>
+
 #include "raylib.h"
 
 namespace key_manager {
+    // Matches raylib's MAX_KEYBOARD_KEYS
+    static constexpr int KEY_COUNT = 512;
+
+    static bool captureEnabled = false;
+    static std::bitset<KEY_COUNT> capturedPressed;
+    static std::bitset<KEY_COUNT> capturedDown;
+
     bool IsKeyPressed(const int& key) {
+        if (captureEnabled) {
+            return key >= 0 && key < KEY_COUNT && capturedPressed.test(key);
+        }
         return ::IsKeyPressed(key);
     }
 
     bool IsKeyDown(const int& key) {
+        if (captureEnabled) {
+            return key >= 0 && key < KEY_COUNT && capturedDown.test(key);
+        }
         return ::IsKeyDown(key);
     }
-}
\ No newline at end of file
+
+    void SetInputCaptureEnabled(bool enabled) {
+        captureEnabled = enabled;
+    }
+
+    void CaptureInput() {
+        for (int key = 0; key < KEY_COUNT; ++key) {
+            capturedPressed.set(key, ::IsKeyPressed(key));
+            capturedDown.set(key, ::IsKeyDown(key));
+        }
+    }
+}
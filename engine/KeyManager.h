@@ -10,6 +10,11 @@
 namespace key_manager {
     DLLEX bool IsKeyPressed(const int &key);
     DLLEX bool IsKeyDown(const int &key);
+
+    // When enabled, queries read the state latched by the last CaptureInput call,
+    // so the simulation thread sees one consistent snapshot per frame
+    DLLEX void SetInputCaptureEnabled(bool enabled);
+    DLLEX void CaptureInput();
 };
 
 
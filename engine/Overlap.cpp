@@ -0,0 +1,152 @@
+#include "Overlap.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define OVERLAP_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        // MSVC emits any intrinsic without per-function flags
+        #define OVERLAP_TARGET(isa)
+    #else
+        #define OVERLAP_TARGET(isa) __attribute__((target(isa)))
+    #endif
+#endif
+
+namespace collision {
+    namespace {
+        size_t OverlapRange(const Aabb& box, const float* minX, const float* minY, const float* maxX,
+                            const float* maxY, size_t begin, size_t end, u32* hits) {
+            size_t hitCount = 0;
+            for (size_t i = begin; i < end; ++i) {
+                // Always written, only kept on a hit
+                hits[hitCount] = static_cast<u32>(i);
+                hitCount += (minX[i] < box.maxX) & (maxX[i] > box.minX) & (minY[i] < box.maxY) & (maxY[i] > box.minY);
+            }
+            return hitCount;
+        }
+
+        size_t OverlapScalar(const Aabb& box, const float* minX, const float* minY,
+                             const float* maxX, const float* maxY, size_t count, u32* hits) {
+            return OverlapRange(box, minX, minY, maxX, maxY, 0, count, hits);
+        }
+
+#ifdef OVERLAP_X86
+        OVERLAP_TARGET("sse2")
+        size_t OverlapSse2(const Aabb& box, const float* minX, const float* minY,
+                           const float* maxX, const float* maxY, size_t count, u32* hits) {
+            const __m128 boxMinX = _mm_set1_ps(box.minX);
+            const __m128 boxMinY = _mm_set1_ps(box.minY);
+            const __m128 boxMaxX = _mm_set1_ps(box.maxX);
+            const __m128 boxMaxY = _mm_set1_ps(box.maxY);
+
+            size_t hitCount = 0;
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 overlap = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(minX + i), boxMaxX), _mm_cmpgt_ps(_mm_loadu_ps(maxX + i), boxMinX));
+                overlap = _mm_and_ps(overlap, _mm_cmplt_ps(_mm_loadu_ps(minY + i), boxMaxY));
+                overlap = _mm_and_ps(overlap, _mm_cmpgt_ps(_mm_loadu_ps(maxY + i), boxMinY));
+                for (u32 mask = static_cast<u32>(_mm_movemask_ps(overlap)); mask != 0; mask &= mask - 1) {
+                    hits[hitCount++] = static_cast<u32>(i) + static_cast<u32>(std::countr_zero(mask));
+                }
+            }
+            return hitCount + OverlapRange(box, minX, minY, maxX, maxY, i, count, hits + hitCount);
+        }
+
+        OVERLAP_TARGET("avx2")
+        size_t OverlapAvx2(const Aabb& box, const float* minX, const float* minY,
+                           const float* maxX, const float* maxY, size_t count, u32* hits) {
+            const __m256 boxMinX = _mm256_set1_ps(box.minX);
+            const __m256 boxMinY = _mm256_set1_ps(box.minY);
+            const __m256 boxMaxX = _mm256_set1_ps(box.maxX);
+            const __m256 boxMaxY = _mm256_set1_ps(box.maxY);
+
+            size_t hitCount = 0;
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 overlap = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minX + i), boxMaxX, _CMP_LT_OQ),
+                                               _mm256_cmp_ps(_mm256_loadu_ps(maxX + i), boxMinX, _CMP_GT_OQ));
+                overlap = _mm256_and_ps(overlap, _mm256_cmp_ps(_mm256_loadu_ps(minY + i), boxMaxY, _CMP_LT_OQ));
+                overlap = _mm256_and_ps(overlap, _mm256_cmp_ps(_mm256_loadu_ps(maxY + i), boxMinY, _CMP_GT_OQ));
+                for (u32 mask = static_cast<u32>(_mm256_movemask_ps(overlap)); mask != 0; mask &= mask - 1) {
+                    hits[hitCount++] = static_cast<u32>(i) + static_cast<u32>(std::countr_zero(mask));
+                }
+            }
+            return hitCount + OverlapRange(box, minX, minY, maxX, maxY, i, count, hits + hitCount);
+        }
+
+        bool CpuHasAvx2() {
+    #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+            __cpuidex(info, 7, 0);
+            return osSavesYmm && (info[1] & (1 << 5)) != 0;
+    #else
+            return __builtin_cpu_supports("avx2");
+    #endif
+        }
+#endif
+
+        std::array<OverlapKernelInfo, 3> BuildKernelTable() {
+            return {{
+#ifdef OVERLAP_X86
+                {"avx2", OverlapAvx2, 8, CpuHasAvx2()},
+                {"sse2", OverlapSse2, 4, true},
+#else
+                {"avx2", OverlapScalar, 8, false},
+                {"sse2", OverlapScalar, 4, false},
+#endif
+                {"scalar", OverlapScalar, 1, true}
+            }};
+        }
+
+        const std::array<OverlapKernelInfo, 3>& KernelTable() {
+            static const auto table = BuildKernelTable();
+            return table;
+        }
+
+        const OverlapKernelInfo& SelectKernel() {
+            // Widest first, scalar is always supported
+            for (const auto& info : KernelTable()) {
+                if (info.supported) return info;
+            }
+            return KernelTable().back();
+        }
+    }
+
+    std::span<const OverlapKernelInfo> GetOverlapKernels() {
+        return KernelTable();
+    }
+
+    const OverlapKernelInfo& GetActiveOverlapKernel() {
+        static const OverlapKernelInfo& active = SelectKernel();
+        return active;
+    }
+
+    size_t OverlapBox(const Aabb& box, const float* minX, const float* minY,
+                      const float* maxX, const float* maxY, size_t count, u32* hits) {
+        static const OverlapKernel kernel = GetActiveOverlapKernel().kernel;
+        return kernel(box, minX, minY, maxX, maxY, count, hits);
+    }
+
+    void OverlapPairs(const AabbSoA& queries, const AabbSoA& targets, std::vector<HitPair>& hits) {
+        constexpr size_t CHUNK = 256;
+        std::array<u32, CHUNK> chunkHits;
+
+        for (size_t query = 0; query < queries.Size(); ++query) {
+            const Aabb box{queries.minX[query], queries.minY[query], queries.maxX[query], queries.maxY[query]};
+            for (size_t first = 0; first < targets.Size(); first += CHUNK) {
+                const size_t count = std::min(CHUNK, targets.Size() - first);
+                const size_t hitCount = OverlapBox(box, targets.minX.data() + first, targets.minY.data() + first,
+                                                   targets.maxX.data() + first, targets.maxY.data() + first, count, chunkHits.data());
+                for (size_t i = 0; i < hitCount; ++i) {
+                    hits.push_back({static_cast<u32>(query), static_cast<u32>(first) + chunkHits[i]});
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#ifndef OVERLAP_H
+#define OVERLAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <vector>
+
+#include "Defines.h"
+#include "raylib.h"
+
+// Batched AABB overlap tests. Boxes are packed SoA into 32-byte aligned float arrays and
+// tested 4 (SSE2) or 8 (AVX2) at a time; the widest kernel the CPU supports is picked once at
+// startup, with a scalar fallback everywhere else. Overlap is strict, boxes that only touch
+// don't hit, matching CheckCollisionRecs in the game.
+namespace collision {
+    template<typename T>
+    struct AlignedAllocator {
+        using value_type = T;
+        static constexpr std::align_val_t ALIGNMENT{32};
+
+        AlignedAllocator() = default;
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U>&) noexcept {}
+
+        T* allocate(size_t count) { return static_cast<T*>(::operator new(count * sizeof(T), ALIGNMENT)); }
+        void deallocate(T* pointer, size_t) noexcept { ::operator delete(pointer, ALIGNMENT); }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U>&) const noexcept { return true; }
+    };
+
+    using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+    struct AabbSoA {
+        AlignedFloats minX, minY, maxX, maxY;
+
+        size_t Size() const { return minX.size(); }
+
+        void Clear() {
+            minX.clear();
+            minY.clear();
+            maxX.clear();
+            maxY.clear();
+        }
+
+        void Push(const Rectangle& bounds) {
+            minX.push_back(bounds.x);
+            minY.push_back(bounds.y);
+            maxX.push_back(bounds.x + bounds.width);
+            maxY.push_back(bounds.y + bounds.height);
+        }
+    };
+
+    struct Aabb {
+        float minX, minY, maxX, maxY;
+
+        static Aabb FromRectangle(const Rectangle& bounds) {
+            return {bounds.x, bounds.y, bounds.x + bounds.width, bounds.y + bounds.height};
+        }
+    };
+
+    // Earliest time in [0, 1] at which `box`, moving by `delta`, starts to overlap `target`; both
+    // boxes are at their start positions. Slab test on the Minkowski sum, so a box moving
+    // further than its own size per step still hits. Strict like the overlap kernels.
+    inline bool SweepAabb(const Aabb& box, Vector2 delta, const Aabb& target, float& time) {
+        float enter = 0.0f;
+        float exit = 1.0f;
+
+        const auto slab = [&](float boxMin, float boxMax, float targetMin, float targetMax, float move) {
+            if (move == 0.0f) {
+                if (!(boxMin < targetMax && boxMax > targetMin)) exit = -1.0f;
+                return;
+            }
+            const float inverse = 1.0f / move;
+            float near = (targetMin - boxMax) * inverse;
+            float far = (targetMax - boxMin) * inverse;
+            if (near > far) std::swap(near, far);
+            enter = std::max(enter, near);
+            exit = std::min(exit, far);
+        };
+        slab(box.minX, box.maxX, target.minX, target.maxX, delta.x);
+        slab(box.minY, box.maxY, target.minY, target.maxY, delta.y);
+
+        // Only touching gives enter == exit
+        if (enter >= exit) return false;
+        time = enter;
+        return true;
+    }
+
+    struct HitPair {
+        u32 query;
+        u32 target;
+    };
+
+    // Writes the index of every box in [0, count) overlapping `box` into `hits`, which must have
+    // room for `count`, and returns how many it wrote. Indices come out in ascending order.
+    using OverlapKernel = size_t (*)(const Aabb& box, const float* minX, const float* minY,
+                                     const float* maxX, const float* maxY, size_t count, u32* hits);
+
+    struct OverlapKernelInfo {
+        const char* name;
+        OverlapKernel kernel;
+        size_t width;       // Boxes per instruction
+        bool supported;     // By this CPU
+    };
+
+    // Runs the dispatched kernel; the arrays may start at any offset into an AabbSoA
+    DLLEX size_t OverlapBox(const Aabb& box, const float* minX, const float* minY,
+                            const float* maxX, const float* maxY, size_t count, u32* hits);
+
+    // Appends a pair for every query/target overlap, grouped by query
+    DLLEX void OverlapPairs(const AabbSoA& queries, const AabbSoA& targets, std::vector<HitPair>& hits);
+
+    // Every kernel built into this binary, for benchmarks and logging
+    DLLEX std::span<const OverlapKernelInfo> GetOverlapKernels();
+    DLLEX const OverlapKernelInfo& GetActiveOverlapKernel();
+}
+
+#endif //OVERLAP_H
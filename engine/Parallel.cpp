@@ -0,0 +1,58 @@
+#include "Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "Engine.h"
+
+namespace parallel {
+    namespace {
+        struct Job {
+            const std::function<void(size_t, size_t)>* body = nullptr;
+            size_t count = 0;
+            size_t chunkSize = 0;
+            size_t chunks = 0;
+            std::atomic<size_t> next{0};
+            std::atomic<size_t> done{0};
+        };
+
+        // Runs chunks until none are left. A task that starts after the caller returned finds
+        // nothing to claim and never touches the body.
+        void RunChunks(Job& job) {
+            for (size_t chunk = job.next.fetch_add(1); chunk < job.chunks; chunk = job.next.fetch_add(1)) {
+                const size_t begin = chunk * job.chunkSize;
+                (*job.body)(begin, std::min(begin + job.chunkSize, job.count));
+                if (job.done.fetch_add(1, std::memory_order_acq_rel) + 1 == job.chunks) {
+                    job.done.notify_all();
+                }
+            }
+        }
+    }
+
+    void For(size_t count, size_t minChunk, const std::function<void(size_t, size_t)>& body) {
+        if (count == 0) return;
+        minChunk = std::max<size_t>(minChunk, 1);
+        const size_t chunks = std::min((count + minChunk - 1) / minChunk, Engine::NUM_WORKER_THREADS + 1);
+        if (chunks <= 1) {
+            body(0, count);
+            return;
+        }
+
+        auto job = std::make_shared<Job>();
+        job->body = &body;
+        job->count = count;
+        job->chunkSize = (count + chunks - 1) / chunks;
+        job->chunks = (count + job->chunkSize - 1) / job->chunkSize;
+
+        for (size_t i = 1; i < job->chunks; ++i) {
+            if (!Engine::QueueWorkerTask([job] { RunChunks(*job); })) break;
+        }
+        RunChunks(*job);
+
+        for (size_t done = job->done.load(std::memory_order_acquire); done < job->chunks;
+             done = job->done.load(std::memory_order_acquire)) {
+            job->done.wait(done, std::memory_order_acquire);
+        }
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <cstddef>
+#include <functional>
+
+#include "Defines.h"
+
+namespace parallel {
+    // Splits [0, count) into chunks of at least minChunk items and runs body(begin, end) on the
+    // worker threads and the calling thread, returning once every chunk is done. The caller
+    // claims chunks itself instead of waiting on queued tasks, so this is safe to call from a
+    // worker; without a running engine it simply runs inline.
+    DLLEX void For(size_t count, size_t minChunk, const std::function<void(size_t, size_t)>& body);
+}
+
+#endif //PARALLEL_H
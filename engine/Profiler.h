@@ -21,6 +21,13 @@ public:
         size_t callCount = 0;
     };
 
+    struct CounterData {
+        double total = 0.0;
+        double minValue = std::numeric_limits<double>::max();
+        double maxValue = 0.0;
+        size_t samples = 0;
+    };
+
     static Profiler& GetInstance() {
         static Profiler instance;
         return instance;
@@ -58,6 +65,18 @@ public:
         data.callCount++;
     }
 
+    // Per-frame quantities that aren't times, e.g. draw counts
+    void RecordCount(const std::string& name, double value) {
+        if (!enabled) return;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& data = counterData[name];
+        data.total += value;
+        data.minValue = std::min(data.minValue, value);
+        data.maxValue = std::max(data.maxValue, value);
+        data.samples++;
+    }
+
     void PrintFrameStats() {
         if (!enabled) return;
         
@@ -68,8 +87,14 @@ public:
             ENGINE_LOG(LOG_INFO, "%s: Avg=%.3fms, Min=%.3fms, Max=%.3fms, Calls=%zu",
                       name.c_str(), avgTime, data.minTime, data.maxTime, data.callCount);
         }
+        for (const auto& [name, data] : counterData) {
+            double avgValue = data.total / data.samples;
+            ENGINE_LOG(LOG_INFO, "%s: Avg=%.1f, Min=%.0f, Max=%.0f",
+                      name.c_str(), avgValue, data.minValue, data.maxValue);
+        }
         ENGINE_LOG(LOG_INFO, "=============================");
         profileData.clear();
+        counterData.clear();
     }
 
     void SetEnabled(bool value) {
@@ -77,6 +102,7 @@ public:
         if (!enabled) {
             std::lock_guard<std::mutex> lock(mutex);
             profileData.clear();
+            counterData.clear();
         }
     }
 
@@ -87,6 +113,7 @@ public:
 private:
     Profiler() = default;
     std::unordered_map<std::string, ProfileData> profileData;
+    std::unordered_map<std::string, CounterData> counterData;
     std::mutex mutex;
     std::atomic<bool> enabled{true};
 };
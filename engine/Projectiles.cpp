@@ -0,0 +1,35 @@
+#include "Projectiles.h"
+
+namespace projectiles {
+    size_t Integrate(float* __restrict x, float* __restrict y, const float* __restrict vx, const float* __restrict vy,
+                     u8* __restrict alive, size_t count, float step, const Rectangle& bounds) {
+        const float left = bounds.x;
+        const float top = bounds.y;
+        const float right = bounds.x + bounds.width;
+        const float bottom = bounds.y + bounds.height;
+
+        for (size_t i = 0; i < count; ++i) {
+            const float px = x[i] + vx[i] * step;
+            const float py = y[i] + vy[i] * step;
+            x[i] = px;
+            y[i] = py;
+            alive[i] = static_cast<u8>(alive[i] & (px >= left) & (px <= right) & (py >= top) & (py <= bottom));
+        }
+
+        size_t aliveCount = 0;
+        for (size_t i = 0; i < count; ++i) {
+            aliveCount += alive[i];
+        }
+        return aliveCount;
+    }
+
+    size_t CompactIndices(const u8* __restrict alive, size_t count, u32* __restrict indices) {
+        // Every index is written, only live ones advance the cursor, so there's no branch to mispredict
+        size_t kept = 0;
+        for (size_t i = 0; i < count; ++i) {
+            indices[kept] = static_cast<u32>(i);
+            kept += alive[i] != 0;
+        }
+        return kept;
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef PROJECTILES_H
+#define PROJECTILES_H
+
+#include <cstddef>
+
+#include "Defines.h"
+#include "raylib.h"
+
+namespace projectiles {
+    // Moves SoA projectiles by their velocity times `step` and clears `alive` for the ones that
+    // ended up outside `bounds` (edges count as inside). Returns how many are still alive.
+    // Branch-free so the compiler can vectorize it.
+    DLLEX size_t Integrate(float* x, float* y, const float* vx, const float* vy, u8* alive,
+                           size_t count, float step, const Rectangle& bounds);
+
+    // Writes the indices of the live entries to `indices` in order and returns how many there
+    // are. Each index is at least its own position, so callers can gather their arrays in place.
+    DLLEX size_t CompactIndices(const u8* alive, size_t count, u32* indices);
+
+    // data[i] = data[indices[i]] for the first `count` entries, the in-place half of a compaction
+    template<typename T>
+    void Gather(T* data, const u32* indices, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            data[i] = data[indices[i]];
+        }
+    }
+}
+
+#endif //PROJECTILES_H
@@ -0,0 +1,203 @@
+#include "RenderCapture.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <type_traits>
+#include <unordered_set>
+
+#include "Log.h"
+
+namespace render::capture {
+    namespace {
+        constexpr u32 CAPTURE_MAGIC = 0x43524750; // "PGRC"
+        constexpr u32 CAPTURE_VERSION = 1;
+
+        static_assert(std::is_trivially_copyable_v<TextureInfo>);
+        static_assert(std::is_trivially_copyable_v<Command>);
+        static_assert(std::is_trivially_copyable_v<TexturedQuad>);
+
+        template<typename T>
+        void WriteValue(std::ofstream& out, const T& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template<typename T>
+        bool ReadValue(std::ifstream& in, T& value) {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        template<typename T>
+        void WriteArray(std::ofstream& out, std::span<const T> values) {
+            WriteValue(out, static_cast<u32>(values.size()));
+            out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size_bytes()));
+        }
+
+        // `remaining` is the bytes left in the file, so a corrupt count fails here instead of
+        // asking for a huge allocation
+        template<typename T>
+        bool ReadArray(std::ifstream& in, T& values, u64& remaining) {
+            u32 count = 0;
+            if (remaining < sizeof(count) || !ReadValue(in, count)) return false;
+            remaining -= sizeof(count);
+
+            const u64 bytes = static_cast<u64>(count) * sizeof(values[0]);
+            if (bytes > remaining) return false;
+            remaining -= bytes;
+
+            values.resize(count);
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(bytes)));
+        }
+
+        // Ranges and types come straight from the file, replay indexes with them unchecked
+        bool ValidCommands(const Frame& frame) {
+            for (const Command& command : frame.commands) {
+                if (command.type > CommandType::EndBlendMode) return false;
+
+                const u64 end = static_cast<u64>(command.first) + command.count;
+                if (command.type == CommandType::Text && end > frame.text.size()) return false;
+                if (command.type == CommandType::Quads && end > frame.quads.size()) return false;
+            }
+            return true;
+        }
+    }
+
+    bool Save(const std::string& file, const Frame& frame) noexcept {
+        std::error_code error;
+        const auto directory = std::filesystem::path(file).parent_path();
+        if (!directory.empty()) std::filesystem::create_directories(directory, error);
+
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            ENGINE_LOG(LOG_WARNING, "Could not write render capture: %s", file.c_str());
+            return false;
+        }
+
+        WriteValue(out, CAPTURE_MAGIC);
+        WriteValue(out, CAPTURE_VERSION);
+        WriteArray<TextureInfo>(out, frame.textures);
+        WriteArray<Command>(out, frame.commands);
+        WriteArray<TexturedQuad>(out, frame.quads);
+        WriteArray<char>(out, frame.text);
+        return static_cast<bool>(out);
+    }
+
+    bool Load(const std::string& file, Frame& frame) noexcept {
+        std::ifstream in(file, std::ios::binary | std::ios::ate);
+        if (!in.is_open()) return false;
+        const std::streamoff size = in.tellg();
+        if (size < 0) return false;
+        in.seekg(0);
+
+        u32 magic = 0, version = 0;
+        if (!ReadValue(in, magic) || !ReadValue(in, version)) return false;
+        if (magic != CAPTURE_MAGIC || version != CAPTURE_VERSION) return false;
+
+        u64 remaining = static_cast<u64>(size) - sizeof(magic) - sizeof(version);
+        return ReadArray(in, frame.textures, remaining) && ReadArray(in, frame.commands, remaining) &&
+               ReadArray(in, frame.quads, remaining) && ReadArray(in, frame.text, remaining) &&
+               ValidCommands(frame);
+    }
+
+    void LoadReplayContext(const Frame& frame, ReplayContext& context) {
+        UnloadReplayContext(context);
+
+        const auto placeholder = [](int width, int height) {
+            Image image = GenImageColor(std::max(width, 1), std::max(height, 1), WHITE);
+            const Texture2D texture = LoadTextureFromImage(image);
+            UnloadImage(image);
+            return texture;
+        };
+        for (const TextureInfo& info : frame.textures) {
+            context.textures.try_emplace(info.id, placeholder(info.width, info.height));
+        }
+        context.missing = placeholder(1, 1);
+
+        for (const Command& command : frame.commands) {
+            if (command.type != CommandType::BeginTextureMode || context.targets.contains(command.texture)) continue;
+            // Captures from before targets recorded their size get the screen's
+            const int width = command.dest.width > 0 ? static_cast<int>(command.dest.width) : ::GetScreenWidth();
+            const int height = command.dest.height > 0 ? static_cast<int>(command.dest.height) : ::GetScreenHeight();
+            context.targets.emplace(command.texture, LoadRenderTexture(width, height));
+        }
+    }
+
+    void UnloadReplayContext(ReplayContext& context) {
+        for (const auto& texture : context.textures | std::views::values) UnloadTexture(texture);
+        for (const auto& target : context.targets | std::views::values) UnloadRenderTexture(target);
+        if (context.missing.id != 0) UnloadTexture(context.missing);
+        context = ReplayContext{};
+    }
+
+    void Replay(const Frame& frame, const ReplayContext& context) {
+        const auto textureFor = [&context](u32 id) -> const Texture2D& {
+            const auto it = context.textures.find(id);
+            return it != context.textures.end() ? it->second : context.missing;
+        };
+
+        for (const Command& command : frame.commands) {
+            switch (command.type) {
+                case CommandType::Texture:
+                    render::DrawTexture(&textureFor(command.texture), static_cast<int>(command.dest.x),
+                                        static_cast<int>(command.dest.y), command.color);
+                    break;
+                case CommandType::Text:
+                    render::DrawText(frame.text.substr(command.first, command.count), static_cast<int>(command.dest.x),
+                                     static_cast<int>(command.dest.y), command.value, command.color);
+                    break;
+                case CommandType::Rectangle:
+                    render::DrawRectanglePro(command.dest, command.origin, command.rotation, command.color);
+                    break;
+                case CommandType::TexturePro:
+                    render::DrawTexturePro(textureFor(command.texture), command.source, command.dest,
+                                           command.origin, command.rotation, command.color);
+                    break;
+                case CommandType::TextureRec:
+                    render::DrawTextureRec(textureFor(command.texture), command.source,
+                                           Vector2{command.dest.x, command.dest.y}, command.color);
+                    break;
+                case CommandType::Quads:
+                    render::DrawTexturedQuads(textureFor(command.texture),
+                                              std::span<const TexturedQuad>(frame.quads).subspan(command.first, command.count),
+                                              Vector2{command.dest.x, command.dest.y}, command.origin, command.rotation, command.color);
+                    break;
+                case CommandType::BeginTextureMode:
+                    if (const auto it = context.targets.find(command.texture); it != context.targets.end()) {
+                        render::BeginTextureMode(it->second);
+                    }
+                    break;
+                case CommandType::EndTextureMode:
+                    render::EndTextureMode();
+                    break;
+                case CommandType::BeginMode2D:
+                    render::BeginMode2D(command.camera);
+                    break;
+                case CommandType::EndMode2D:
+                    render::EndMode2D();
+                    break;
+                case CommandType::BeginBlendMode:
+                    render::BeginBlendMode(command.value);
+                    break;
+                case CommandType::EndBlendMode:
+                    render::EndBlendMode();
+                    break;
+            }
+        }
+    }
+
+    u32 SortedBatchEstimate(const Frame& frame) {
+        // Sorting a segment by texture leaves one run per distinct texture in it
+        u32 batches = 0;
+        std::unordered_set<u32> segmentTextures;
+        for (const Command& command : frame.commands) {
+            if (command.type >= CommandType::BeginTextureMode) {
+                batches += static_cast<u32>(segmentTextures.size());
+                segmentTextures.clear();
+            } else {
+                segmentTextures.insert(command.texture);
+            }
+        }
+        return batches + static_cast<u32>(segmentTextures.size());
+    }
+}
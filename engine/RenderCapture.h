@@ -0,0 +1,83 @@
+#ifndef RENDERCAPTURE_H
+#define RENDERCAPTURE_H
+
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Defines.h"
+#include "Renderer.h"
+
+// Serialized render:: command streams, replayed through the renderer so renderer changes
+// can be benchmarked on real frames.
+namespace render::capture {
+    struct TextureInfo {
+        u32 id;
+        i32 width;
+        i32 height;
+        i32 mipmaps;
+        i32 format;
+    };
+
+    enum class CommandType : u8 {
+        Texture,
+        Text,
+        Rectangle,
+        TexturePro,
+        TextureRec,
+        Quads,
+        BeginTextureMode,
+        EndTextureMode,
+        BeginMode2D,
+        EndMode2D,
+        BeginBlendMode,
+        EndBlendMode
+    };
+
+    // One captured call. Fields a command type doesn't use stay zero.
+    struct Command {
+        CommandType type;
+        u32 texture = 0;            // Texture id, or the render target id for BeginTextureMode
+        Rectangle source{};
+        Rectangle dest{};           // x/y hold the position of Texture, TextureRec and Text, width/height the size of a BeginTextureMode target
+        Vector2 origin{};
+        float rotation = 0.0f;
+        Color color{};
+        u32 first = 0;              // Quads: range in Frame::quads, Text: range in Frame::text
+        u32 count = 0;
+        i32 value = 0;              // Text font size or blend mode
+        Camera2D camera{};
+    };
+
+    struct Frame {
+        std::vector<TextureInfo> textures;
+        std::vector<Command> commands;
+        std::vector<TexturedQuad> quads;
+        std::string text;
+    };
+
+    DLLEX bool Save(const std::string& file, const Frame& frame) noexcept;
+    DLLEX bool Load(const std::string& file, Frame& frame) noexcept;
+
+    // GPU stand-ins for the textures and render targets a capture refers to, keyed by their
+    // captured ids. Needs a GL context; draws only look the part in size, not in content.
+    struct ReplayContext {
+        std::unordered_map<u32, Texture2D> textures;
+        std::unordered_map<u32, RenderTexture2D> targets;
+        Texture2D missing{};        // Drawn for ids the capture has no TextureInfo for
+    };
+
+    DLLEX void LoadReplayContext(const Frame& frame, ReplayContext& context);
+    DLLEX void UnloadReplayContext(ReplayContext& context);
+
+    // Issues the frame's commands through the render:: calls that recorded them, so replay runs
+    // the same renderer code as the game. Call between render::BeginDraw and render::EndDraw.
+    DLLEX void Replay(const Frame& frame, const ReplayContext& context);
+
+    // Draw calls the frame would need if the draws between state changes were sorted by
+    // texture. Hypothetical: it ignores overlap, so that reordering is not always valid.
+    DLLEX u32 SortedBatchEstimate(const Frame& frame);
+}
+
+#endif //RENDERCAPTURE_H
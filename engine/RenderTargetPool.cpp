@@ -0,0 +1,92 @@
+#include "RenderTargetPool.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "rlgl.h"
+#include "Log.h"
+
+namespace render {
+    namespace {
+        // Idle targets survive this many frames, long enough to bridge a scene switch
+        constexpr u64 IDLE_EVICTION_FRAMES = 300;
+
+        struct PooledTarget {
+            RenderTexture2D target;
+            i32 format;
+            bool inUse;
+            u64 releasedFrame;
+        };
+
+        std::vector<PooledTarget> pool;
+        u64 currentFrame = 0;
+
+        RenderTexture2D CreateTarget(i32 width, i32 height, i32 format) {
+            if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+                return LoadRenderTexture(width, height);
+            }
+
+            // Same setup as LoadRenderTexture, with the requested colour format
+            RenderTexture2D target{};
+            target.id = rlLoadFramebuffer();
+            if (target.id == 0) return target;
+
+            rlEnableFramebuffer(target.id);
+            target.texture = Texture2D{rlLoadTexture(nullptr, width, height, format, 1), width, height, 1, format};
+            target.depth = Texture2D{rlLoadTextureDepth(width, height, true), width, height, 1, 19};
+            rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+            rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+            if (!rlFramebufferComplete(target.id)) {
+                ENGINE_LOG(LOG_WARNING, "Render target %dx%d (format %d) is incomplete", width, height, format);
+            }
+            rlDisableFramebuffer();
+            return target;
+        }
+    }
+
+    RenderTexture2D AcquireRenderTarget(i32 width, i32 height, i32 format) {
+        for (auto& pooled : pool) {
+            if (!pooled.inUse && pooled.format == format &&
+                pooled.target.texture.width == width && pooled.target.texture.height == height) {
+                pooled.inUse = true;
+                return pooled.target;
+            }
+        }
+
+        const RenderTexture2D target = CreateTarget(width, height, format);
+        if (target.id != 0) {
+            pool.push_back(PooledTarget{target, format, true, 0});
+        }
+        return target;
+    }
+
+    void ReleaseRenderTarget(const RenderTexture2D& target) {
+        if (target.id == 0) return;
+
+        const auto it = std::ranges::find_if(pool, [&target](const PooledTarget& pooled) {
+            return pooled.target.id == target.id;
+        });
+        if (it == pool.end() || !it->inUse) {
+            ENGINE_LOG(LOG_WARNING, "Released render target %u that the pool doesn't hand out", target.id);
+            return;
+        }
+        it->inUse = false;
+        it->releasedFrame = currentFrame;
+    }
+
+    void TrimRenderTargetPool() {
+        ++currentFrame;
+        std::erase_if(pool, [](const PooledTarget& pooled) {
+            if (pooled.inUse || currentFrame - pooled.releasedFrame <= IDLE_EVICTION_FRAMES) return false;
+            UnloadRenderTexture(pooled.target);
+            return true;
+        });
+    }
+
+    void ClearRenderTargetPool() {
+        for (const auto& pooled : pool) {
+            UnloadRenderTexture(pooled.target);
+        }
+        pool.clear();
+    }
+}
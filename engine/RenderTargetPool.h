@@ -0,0 +1,20 @@
+#ifndef RENDERTARGETPOOL_H
+#define RENDERTARGETPOOL_H
+
+#include "Defines.h"
+#include "raylib.h"
+
+namespace render {
+    // Render textures shared across scenes and frames, keyed by size and format.
+    // Released targets stay allocated and are handed out again by the next matching
+    // Acquire; ones left idle for a few seconds are freed. Main thread only.
+    DLLEX RenderTexture2D AcquireRenderTarget(i32 width, i32 height, i32 format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    DLLEX void ReleaseRenderTarget(const RenderTexture2D& target);
+
+    // Frees idle targets, called once per frame by the renderer
+    DLLEX void TrimRenderTargetPool();
+    // Frees every target, acquired or not
+    DLLEX void ClearRenderTargetPool();
+}
+
+#endif //RENDERTARGETPOOL_H
@@ -4,23 +4,119 @@
 
 #include "Renderer.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 
 #include "raylib.h"
+#include "rlgl.h"
 #include "Log.h"
+#include "TextLayout.h"
+#include "Profiler.h"
+#include "RenderCapture.h"
+#include "RenderTargetPool.h"
 
 namespace render {
     // Static member initialization
     static std::vector<DrawCommand> drawCommands;
+    static std::vector<TexturedQuad> quadArena;
     static bool isBatching = false;
     static Color backgroundColor = BLUE;  // Default background color
 
+    static std::string captureFile;
+    static bool captureRequested = false;
+    static bool capturing = false;
+    static capture::Frame captureFrame;
+
+    static RenderStats frameStats;
+    static RenderStats lastFrameStats;
+    static unsigned int boundTexture = 0;
+
+    // Keeps each rlBegin/rlEnd block well inside one raylib vertex batch
+    static constexpr size_t MAX_QUADS_PER_SUBMIT = 1024;
+
+    static float MillisecondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static void CountDraw(unsigned int textureId, u32 vertexCount) {
+        ++frameStats.commands;
+        frameStats.vertices += vertexCount;
+        if (textureId != boundTexture) {
+            ++frameStats.textureSwitches;
+            boundTexture = textureId;
+        }
+    }
+
+    static void CaptureTexture(const Texture2D& texture) {
+        for (const auto& info : captureFrame.textures) {
+            if (info.id == texture.id) return;
+        }
+        captureFrame.textures.push_back({texture.id, texture.width, texture.height, texture.mipmaps, texture.format});
+    }
+
+    static void CaptureState(capture::CommandType type, u32 target = 0, Camera2D camera = {}, int blendMode = 0) {
+        captureFrame.commands.push_back(capture::Command{.type = type, .texture = target, .value = blendMode, .camera = camera});
+    }
+
+    static void CountStateSwitch() {
+        ++frameStats.stateSwitches;
+    }
+
+    // Default font text draws one quad per visible character
+    static u32 TextVertices(const char* text) {
+        u32 glyphs = 0;
+        for (const char* c = text; *c != '\0'; ++c) {
+            if (*c != ' ' && *c != '\n' && (static_cast<unsigned char>(*c) & 0xC0) != 0x80) ++glyphs;
+        }
+        return glyphs * 4;
+    }
+
+    static void SubmitQuads(const Texture2D& texture, std::span<const TexturedQuad> quads,
+                            Vector2 position, Vector2 origin, float rotation, Color tint) {
+        if (quads.empty()) return;
+        CountDraw(texture.id, static_cast<u32>(quads.size() * 4));
+
+        rlSetTexture(texture.id);
+        rlPushMatrix();
+        rlTranslatef(position.x, position.y, 0.0f);
+        if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+        rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+        for (size_t first = 0; first < quads.size(); first += MAX_QUADS_PER_SUBMIT) {
+            const size_t count = std::min(MAX_QUADS_PER_SUBMIT, quads.size() - first);
+            rlCheckRenderBatchLimit(static_cast<int>(count * 4));
+
+            rlBegin(RL_QUADS);
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);
+            for (const TexturedQuad& quad : quads.subspan(first, count)) {
+                rlTexCoord2f(quad.u0, quad.v0);
+                rlVertex2f(quad.x0, quad.y0);
+                rlTexCoord2f(quad.u0, quad.v1);
+                rlVertex2f(quad.x0, quad.y1);
+                rlTexCoord2f(quad.u1, quad.v1);
+                rlVertex2f(quad.x1, quad.y1);
+                rlTexCoord2f(quad.u1, quad.v0);
+                rlVertex2f(quad.x1, quad.y0);
+            }
+            rlEnd();
+        }
+
+        rlPopMatrix();
+        rlSetTexture(0);
+    }
+
     void Initialize() {
         drawCommands.reserve(1000); // Pre-allocate space for commands
+        quadArena.reserve(4096);
     }
 
     void Shutdown() {
         drawCommands.clear();
+        quadArena.clear();
+        ClearTextLayoutCache();
+        ClearRenderTargetPool();
     }
 
     void SetBackgroundColor(Color color) {
@@ -52,27 +148,50 @@ namespace render {
             std::visit([](const auto& command) {
                 using T = std::decay_t<decltype(command)>;
                 if constexpr (std::is_same_v<T, TextureCommand>) {
+                    CountDraw(command.texture->id, 4);
                     ::DrawTexture(*command.texture, command.x, command.y, command.color);
                 }
                 else if constexpr (std::is_same_v<T, TextCommand>) {
+                    CountDraw(GetFontDefault().texture.id, TextVertices(command.text.c_str()));
                     ::DrawText(command.text.c_str(), command.x, command.y, command.fontSize, command.color);
                 }
                 else if constexpr (std::is_same_v<T, RectangleCommand>) {
+                    CountDraw(GetShapesTexture().id, 4);
                     ::DrawRectanglePro(command.rec, command.origin, command.rotation, command.color);
                 }
                 else if constexpr (std::is_same_v<T, TextureProCommand>) {
+                    CountDraw(command.texture->id, 4);
                     ::DrawTexturePro(*command.texture, command.source, command.dest, 
                                    command.origin, command.rotation, command.tint);
                 }
                 else if constexpr (std::is_same_v<T, TextureRecCommand>) {
+                    CountDraw(command.texture->id, 4);
                     ::DrawTextureRec(*command.texture, command.source, command.position, command.tint);
                 }
+                else if constexpr (std::is_same_v<T, QuadsCommand>) {
+                    SubmitQuads(command.texture,
+                                std::span<const TexturedQuad>(quadArena).subspan(command.firstQuad, command.quadCount),
+                                command.position, command.origin, command.rotation, command.tint);
+                }
             }, cmd);
         }
         drawCommands.clear();
+        quadArena.clear();
+    }
+
+    void CaptureNextFrame(const std::string& file) {
+        captureFile = file;
+        captureRequested = true;
     }
 
     void BeginDraw() {
+        if (captureRequested) {
+            captureRequested = false;
+            capturing = true;
+            captureFrame = capture::Frame{};
+        }
+        frameStats = RenderStats{};
+        boundTexture = 0;
         BeginDrawing();
     }
 
@@ -81,16 +200,111 @@ namespace render {
     }
 
     void EndDraw() {
-        if (isBatching) {
-            FlushBatch();
+        {
+            PROFILE_SCOPE("Render::FlushBatch");
+            if (isBatching) {
+                FlushBatch();
+            }
+        }
+
+        const auto endStart = std::chrono::steady_clock::now();
+        {
+            PROFILE_SCOPE("Render::EndDrawing");
+            EndDrawing();
         }
-        EndDrawing();
+        frameStats.endDrawingMs = MillisecondsSince(endStart);
+
+        if (capturing) {
+            capturing = false;
+            if (capture::Save(captureFile, captureFrame)) {
+                ENGINE_LOG(LOG_INFO, "Captured %zu render commands to %s", captureFrame.commands.size(), captureFile.c_str());
+            }
+            captureFrame = capture::Frame{};
+        }
+
+        // raylib draws the batch internally, so this assumes every state switch and the end of the
+        // frame draw it, as does running out of room in it
+        frameStats.estimatedBatchFlushes = frameStats.stateSwitches + 1 +
+            frameStats.vertices / (RL_DEFAULT_BATCH_BUFFER_ELEMENTS * 4) +
+            frameStats.textureSwitches / RL_DEFAULT_BATCH_DRAWCALLS;
+        lastFrameStats = frameStats;
+
+        auto& profiler = Profiler::GetInstance();
+        if (profiler.IsEnabled()) {
+            profiler.RecordCount("Render::Commands", lastFrameStats.commands);
+            profiler.RecordCount("Render::TextureSwitches", lastFrameStats.textureSwitches);
+            profiler.RecordCount("Render::StateSwitches", lastFrameStats.stateSwitches);
+            profiler.RecordCount("Render::Vertices", lastFrameStats.vertices);
+            profiler.RecordCount("Render::EstimatedBatchFlushes", lastFrameStats.estimatedBatchFlushes);
+        }
+
+        TrimTextLayoutCache();
+        TrimRenderTargetPool();
+    }
+
+    const RenderStats& GetRenderStats() {
+        return lastFrameStats;
+    }
+
+    void BeginTextureMode(const RenderTexture2D& target) {
+        FlushBatch();
+        if (capturing) {
+            captureFrame.commands.push_back(capture::Command{.type = capture::CommandType::BeginTextureMode, .texture = target.id,
+                .dest = Rectangle{0, 0, static_cast<float>(target.texture.width), static_cast<float>(target.texture.height)}});
+        }
+        CountStateSwitch();
+        ::BeginTextureMode(target);
+    }
+
+    void EndTextureMode() {
+        FlushBatch();
+        if (capturing) CaptureState(capture::CommandType::EndTextureMode);
+        CountStateSwitch();
+        ::EndTextureMode();
+    }
+
+    void BeginMode2D(const Camera2D& camera) {
+        FlushBatch();
+        if (capturing) CaptureState(capture::CommandType::BeginMode2D, 0, camera);
+        CountStateSwitch();
+        ::BeginMode2D(camera);
+    }
+
+    void EndMode2D() {
+        FlushBatch();
+        if (capturing) CaptureState(capture::CommandType::EndMode2D);
+        CountStateSwitch();
+        ::EndMode2D();
+    }
+
+    void BeginBlendMode(int mode) {
+        FlushBatch();
+        if (capturing) CaptureState(capture::CommandType::BeginBlendMode, 0, {}, mode);
+        CountStateSwitch();
+        if (mode == BLEND_LAYER_TARGET) {
+            rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                                      RL_FUNC_ADD, RL_FUNC_ADD);
+        }
+        ::BeginBlendMode(mode);
+    }
+
+    void EndBlendMode() {
+        FlushBatch();
+        if (capturing) CaptureState(capture::CommandType::EndBlendMode);
+        CountStateSwitch();
+        ::EndBlendMode();
     }
 
     void DrawTexture(const Texture2D* texture, int x, int y, Color color) {
+        if (capturing) {
+            CaptureTexture(*texture);
+            captureFrame.commands.push_back(capture::Command{.type = capture::CommandType::Texture, .texture = texture->id,
+                .dest = Rectangle{static_cast<float>(x), static_cast<float>(y), 0, 0}, .color = color});
+        }
         if (isBatching) {
             drawCommands.emplace_back(TextureCommand{texture, x, y, color});
         } else {
+            CountDraw(texture->id, 4);
             ::DrawTexture(*texture, x, y, color);
         }
     }
@@ -100,15 +314,44 @@ namespace render {
     }
 
     void DrawText(const str& text, int x, int y, int fontSize, Color color) {
+        if (capturing) {
+            const Texture2D& fontTexture = GetFontDefault().texture;
+            CaptureTexture(fontTexture);
+            captureFrame.commands.push_back(capture::Command{.type = capture::CommandType::Text, .texture = fontTexture.id,
+                .dest = Rectangle{static_cast<float>(x), static_cast<float>(y), 0, 0}, .color = color,
+                .first = static_cast<u32>(captureFrame.text.size()), .count = static_cast<u32>(text.size()), .value = fontSize});
+            captureFrame.text += text;
+        }
         if (isBatching) {
             drawCommands.emplace_back(TextCommand{text, x, y, fontSize, color});
         } else {
+            CountDraw(GetFontDefault().texture.id, TextVertices(text.c_str()));
             ::DrawText(text.c_str(), x, y, fontSize, color);
         }
     }
 
+    void DrawTexturedQuads(const Texture2D& texture, std::span<const TexturedQuad> quads,
+                           Vector2 position, Vector2 origin, float rotation, Color tint) {
+        if (capturing) {
+            CaptureTexture(texture);
+            captureFrame.commands.push_back(capture::Command{.type = capture::CommandType::Quads, .texture = texture.id,
+                .dest = Rectangle{position.x, position.y, 0, 0}, .origin = origin, .rotation = rotation, .color = tint,
+                .first = static_cast<u32>(captureFrame.quads.size()), .count = static_cast<u32>(quads.size())});
+            captureFrame.quads.insert(captureFrame.quads.end(), quads.begin(), quads.end());
+        }
+        if (isBatching) {
+            const auto firstQuad = static_cast<u32>(quadArena.size());
+            quadArena.insert(quadArena.end(), quads.begin(), quads.end());
+            drawCommands.emplace_back(QuadsCommand{texture, firstQuad, static_cast<u32>(quads.size()),
+                                                   position, origin, rotation, tint});
+        } else {
+            SubmitQuads(texture, quads, position, origin, rotation, tint);
+        }
+    }
+
     void DrawTextPro(Font font, const char* text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint) {
-        ::DrawTextPro(font, text, position, origin, rotation, fontSize, spacing, tint);
+        const auto layout = GetTextLayout(font, text, fontSize, spacing);
+        DrawTexturedQuads(font.texture, layout->quads, position, origin, rotation, tint);
     }
 
     void DrawTextPixelPerfect(Font font, const char *text, Vector2 position, float fontSize, float spacing,
@@ -123,7 +366,8 @@ namespace render {
         float pixelSpacing = roundf(spacing);
 
         // Draw with exact positioning
-        ::DrawTextEx(font, text, pixelPos, fontSize, pixelSpacing, tint);
+        const auto layout = GetTextLayout(font, text, fontSize, pixelSpacing);
+        DrawTexturedQuads(font.texture, layout->quads, pixelPos, Vector2{0.0f, 0.0f}, 0.0f, tint);
     }
 
     int MeasureText(const str& text, int fontSize) {
@@ -147,25 +391,44 @@ namespace render {
     }
 
     void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color) {
+        if (capturing) {
+            const Texture2D shapes = GetShapesTexture();
+            CaptureTexture(shapes);
+            captureFrame.commands.push_back(capture::Command{.type = capture::CommandType::Rectangle, .texture = shapes.id,
+                .dest = rec, .origin = origin, .rotation = rotation, .color = color});
+        }
         if (isBatching) {
             drawCommands.emplace_back(RectangleCommand{rec, origin, rotation, color});
         } else {
+            CountDraw(GetShapesTexture().id, 4);
             ::DrawRectanglePro(rec, origin, rotation, color);
         }
     }
 
     void DrawTexturePro(const Texture2D& texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+        if (capturing) {
+            CaptureTexture(texture);
+            captureFrame.commands.push_back(capture::Command{.type = capture::CommandType::TexturePro, .texture = texture.id,
+                .source = source, .dest = dest, .origin = origin, .rotation = rotation, .color = tint});
+        }
         if (isBatching) {
             drawCommands.emplace_back(TextureProCommand{&texture, source, dest, origin, rotation, tint});
         } else {
+            CountDraw(texture.id, 4);
             ::DrawTexturePro(texture, source, dest, origin, rotation, tint);
         }
     }
 
     void DrawTextureRec(const Texture2D& texture, Rectangle source, Vector2 position, Color tint) {
+        if (capturing) {
+            CaptureTexture(texture);
+            captureFrame.commands.push_back(capture::Command{.type = capture::CommandType::TextureRec, .texture = texture.id,
+                .source = source, .dest = Rectangle{position.x, position.y, 0, 0}, .color = tint});
+        }
         if (isBatching) {
             drawCommands.emplace_back(TextureRecCommand{&texture, source, position, tint});
         } else {
+            CountDraw(texture.id, 4);
             ::DrawTextureRec(texture, source, position, tint);
         }
     }
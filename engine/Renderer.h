@@ -7,11 +7,29 @@
 
 #include "Defines.h"
 #include "raylib.h"
+#include <span>
 #include <vector>
 #include <variant>
 #include <string>
 
 namespace render {
+    // Corners and texture coordinates of one axis-aligned quad
+    struct TexturedQuad {
+        float x0, y0, x1, y1;
+        float u0, v0, u1, v1;
+    };
+
+    // Renderer cost of one frame. Batch flushes are estimated from the events that force
+    // raylib to draw its vertex batch, since rlgl doesn't expose the real count.
+    struct RenderStats {
+        u32 commands = 0;           // Draws submitted to raylib
+        u32 textureSwitches = 0;    // Draws that bound a different texture than the one before
+        u32 stateSwitches = 0;      // Render target, camera and blend mode changes
+        u32 vertices = 0;
+        u32 estimatedBatchFlushes = 0;
+        float endDrawingMs = 0.0f;  // EndDrawing, including the final batch draw and buffer swap
+    };
+
     // Batch rendering structures
     struct TextureCommand {
         const Texture2D* texture;
@@ -49,12 +67,24 @@ namespace render {
         Color tint;
     };
 
+    // A run of quads sharing one texture, stored in the frame's quad arena
+    struct QuadsCommand {
+        Texture2D texture;          // By value, callers often pass a temporary Font
+        u32 firstQuad;
+        u32 quadCount;
+        Vector2 position;
+        Vector2 origin;
+        float rotation;
+        Color tint;
+    };
+
     using DrawCommand = std::variant<
         TextureCommand,
         TextCommand,
         RectangleCommand,
         TextureProCommand,
-        TextureRecCommand
+        TextureRecCommand,
+        QuadsCommand
     >;
 
     // Initialize and shutdown
@@ -72,6 +102,26 @@ namespace render {
     DLLEX void EndDraw();
     DLLEX void SetBackgroundColor(Color color);
 
+    // Stats of the last completed frame
+    DLLEX const RenderStats& GetRenderStats();
+
+    // Writes every render:: call of the next frame to a capture file for render_replay
+    DLLEX void CaptureNextFrame(const std::string& file);
+
+    // Blend mode for drawing into a cleared render target that is later composited with
+    // BLEND_ALPHA_PREMULTIPLY. Colour blends like BLEND_ALPHA, but alpha accumulates as
+    // a + dst * (1 - a) instead of being scaled by itself, so the target holds premultiplied
+    // colour. BeginBlendMode sets its factors; nothing else uses BLEND_CUSTOM_SEPARATE.
+    constexpr int BLEND_LAYER_TARGET = BLEND_CUSTOM_SEPARATE;
+
+    // State changes, counted in the render stats
+    DLLEX void BeginTextureMode(const RenderTexture2D& target);
+    DLLEX void EndTextureMode();
+    DLLEX void BeginMode2D(const Camera2D& camera);
+    DLLEX void EndMode2D();
+    DLLEX void BeginBlendMode(int mode);
+    DLLEX void EndBlendMode();
+
     DLLEX void DrawTexture(const Texture2D* texture, int x, int y, Color color);
     DLLEX void DrawTextureV(const Texture2D* texture, Vector2 position, Color color);
     DLLEX void DrawText(const str& text, int x, int y, int fontSize, Color color);
@@ -85,6 +135,8 @@ namespace render {
     DLLEX void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color);
     DLLEX void DrawTexturePro(const Texture2D& texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
     DLLEX void DrawTextureRec(const Texture2D& texture, Rectangle source, Vector2 position, Color tint);
+    DLLEX void DrawTexturedQuads(const Texture2D& texture, std::span<const TexturedQuad> quads,
+                                 Vector2 position, Vector2 origin, float rotation, Color tint);
 }
 
 #endif //ENGINE_RENDERER_H
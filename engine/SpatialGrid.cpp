@@ -0,0 +1,51 @@
+#include "SpatialGrid.h"
+
+#include <cmath>
+
+void SpatialGrid::Reset(const Rectangle& area, float cellSize) {
+    this->area = area;
+    inverseCellSize = 1.0f / cellSize;
+    columns = std::max(1, static_cast<i32>(std::ceil(area.width / cellSize)));
+    rows = std::max(1, static_cast<i32>(std::ceil(area.height / cellSize)));
+    cellStart.assign(static_cast<size_t>(columns) * rows + 1, 0);
+    entries.clear();
+    entryMinX.clear();
+    entryMinY.clear();
+}
+
+void SpatialGrid::Build(const float* minX, const float* minY, const float* maxX, const float* maxY, size_t count) {
+    entryMinX.assign(minX, minX + count);
+    entryMinY.assign(minY, minY + count);
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+
+    // Count into cellStart[cell + 1], so the prefix sum turns counts into start offsets
+    for (size_t i = 0; i < count; ++i) {
+        const i32 firstX = CellX(minX[i]), lastX = CellX(maxX[i]);
+        const i32 firstY = CellY(minY[i]), lastY = CellY(maxY[i]);
+        for (i32 y = firstY; y <= lastY; ++y) {
+            for (i32 x = firstX; x <= lastX; ++x) {
+                ++cellStart[static_cast<size_t>(y) * columns + x + 1];
+            }
+        }
+    }
+    for (size_t cell = 1; cell < cellStart.size(); ++cell) {
+        cellStart[cell] += cellStart[cell - 1];
+    }
+
+    // Fill walking each cell's cursor, which ends up at the next cell's start
+    entries.resize(cellStart.back());
+    for (size_t i = 0; i < count; ++i) {
+        const i32 firstX = CellX(minX[i]), lastX = CellX(maxX[i]);
+        const i32 firstY = CellY(minY[i]), lastY = CellY(maxY[i]);
+        for (i32 y = firstY; y <= lastY; ++y) {
+            for (i32 x = firstX; x <= lastX; ++x) {
+                entries[cellStart[static_cast<size_t>(y) * columns + x]++] = static_cast<u32>(i);
+            }
+        }
+    }
+    // Every cursor moved one cell forward, shift them back into start offsets
+    for (size_t cell = cellStart.size() - 1; cell > 0; --cell) {
+        cellStart[cell] = cellStart[cell - 1];
+    }
+    cellStart[0] = 0;
+}
@@ -0,0 +1,71 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "Defines.h"
+#include "raylib.h"
+
+// Uniform grid broadphase over a fixed area. Build buckets SoA bounds into every cell they
+// overlap with a counting sort, so each cell is a contiguous range of one index array and a
+// warm rebuild allocates nothing. Bounds outside the area land in the border cells.
+//
+// Query is const and keeps no scratch state, so any number of threads can query one grid.
+class SpatialGrid {
+public:
+    DLLEX void Reset(const Rectangle& area, float cellSize);
+    DLLEX void Build(const float* minX, const float* minY, const float* maxX, const float* maxY, size_t count);
+
+    // Calls visit(index) once for every entry sharing a cell with `bounds`, until visit returns
+    // false. Candidates only; the caller does the exact test.
+    template<typename Visit>
+    void Query(const Rectangle& bounds, Visit&& visit) const {
+        if (entryMinX.empty()) return;
+        const i32 firstX = CellX(bounds.x);
+        const i32 lastX = CellX(bounds.x + bounds.width);
+        const i32 firstY = CellY(bounds.y);
+        const i32 lastY = CellY(bounds.y + bounds.height);
+
+        for (i32 y = firstY; y <= lastY; ++y) {
+            for (i32 x = firstX; x <= lastX; ++x) {
+                const size_t cell = static_cast<size_t>(y) * columns + x;
+                for (u32 i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                    const u32 index = entries[i];
+                    // An entry spanning several cells is reported only from the cell holding the
+                    // top-left corner of its overlap with the query
+                    if (CellX(std::max(bounds.x, entryMinX[index])) != x ||
+                        CellY(std::max(bounds.y, entryMinY[index])) != y) {
+                        continue;
+                    }
+                    if (!visit(index)) return;
+                }
+            }
+        }
+    }
+
+    i32 GetColumns() const { return columns; }
+    i32 GetRows() const { return rows; }
+    size_t GetEntryCount() const { return entryMinX.size(); }
+
+private:
+    i32 CellX(float x) const {
+        return std::clamp(static_cast<i32>((x - area.x) * inverseCellSize), 0, columns - 1);
+    }
+    i32 CellY(float y) const {
+        return std::clamp(static_cast<i32>((y - area.y) * inverseCellSize), 0, rows - 1);
+    }
+
+    Rectangle area{};
+    float inverseCellSize = 1.0f;
+    i32 columns = 1;
+    i32 rows = 1;
+
+    std::vector<u32> cellStart;     // columns * rows + 1 offsets into entries
+    std::vector<u32> entries;       // Entry indices, grouped by cell
+    std::vector<float> entryMinX;   // Kept for Query's duplicate filter
+    std::vector<float> entryMinY;
+};
+
+#endif //SPATIALGRID_H
@@ -0,0 +1,161 @@
+#include "TextLayout.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace render {
+    namespace {
+        // raylib's default line spacing for DrawTextEx/MeasureTextEx
+        constexpr float TEXT_LINE_SPACING = 2.0f;
+        // Entries not requested for this many frames are dropped
+        constexpr u64 CACHE_EVICTION_FRAMES = 600;
+
+        struct LayoutKey {
+            std::string text;
+            unsigned int fontTexture;
+            const Rectangle* fontRecs;
+            float fontSize;
+            float spacing;
+
+            bool operator==(const LayoutKey&) const = default;
+        };
+
+        struct LayoutKeyHash {
+            size_t operator()(const LayoutKey& key) const noexcept {
+                size_t hash = std::hash<std::string>{}(key.text);
+                const auto combine = [&hash](size_t value) {
+                    hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+                };
+                combine(std::hash<unsigned int>{}(key.fontTexture));
+                combine(std::hash<const void*>{}(key.fontRecs));
+                combine(std::hash<float>{}(key.fontSize));
+                combine(std::hash<float>{}(key.spacing));
+                return hash;
+            }
+        };
+
+        struct CacheEntry {
+            std::shared_ptr<const TextLayout> layout;
+            u64 lastUsedFrame;
+        };
+
+        // Layouts may be resolved on the simulation thread while the render thread trims
+        std::mutex layoutCacheMutex;
+        std::unordered_map<LayoutKey, CacheEntry, LayoutKeyHash> layoutCache;
+        u64 currentFrame = 0;
+
+        std::shared_ptr<const TextLayout> BuildLayout(const Font& font, std::string text, float fontSize, float spacing) {
+            auto layout = std::make_shared<TextLayout>();
+            layout->fontTexture = font.texture.id;
+            layout->fontRecs = font.recs;
+            layout->fontSize = fontSize;
+            layout->spacing = spacing;
+
+            const float scale = fontSize / static_cast<float>(font.baseSize);
+            const float padding = static_cast<float>(font.glyphPadding);
+            const float textureWidth = static_cast<float>(font.texture.width);
+            const float textureHeight = static_cast<float>(font.texture.height);
+
+            // Pen position, same walk as DrawTextEx
+            float penX = 0.0f;
+            float penY = 0.0f;
+
+            // Size, same quirks as MeasureTextEx
+            float lineWidth = 0.0f, maxLineWidth = 0.0f;
+            int lineGlyphs = 0, maxLineGlyphs = 0;
+            float height = fontSize;
+
+            layout->quads.reserve(text.size());
+            for (size_t i = 0; i < text.size(); ) {
+                int byteCount = 0;
+                const int codepoint = GetCodepointNext(text.c_str() + i, &byteCount);
+                const int index = GetGlyphIndex(font, codepoint);
+                i += static_cast<size_t>(std::max(byteCount, 1));
+
+                if (codepoint == '\n') {
+                    penX = 0.0f;
+                    penY += fontSize + TEXT_LINE_SPACING;
+                    maxLineWidth = std::max(maxLineWidth, lineWidth);
+                    lineWidth = 0.0f;
+                    lineGlyphs = 0;
+                    height += fontSize + TEXT_LINE_SPACING;
+                    continue;
+                }
+
+                const GlyphInfo& glyph = font.glyphs[index];
+                const Rectangle& rec = font.recs[index];
+
+                if (codepoint != ' ' && codepoint != '\t') {
+                    const float x0 = penX + (static_cast<float>(glyph.offsetX) - padding) * scale;
+                    const float y0 = penY + (static_cast<float>(glyph.offsetY) - padding) * scale;
+                    layout->quads.push_back(TexturedQuad{
+                        x0, y0,
+                        x0 + (rec.width + 2.0f * padding) * scale,
+                        y0 + (rec.height + 2.0f * padding) * scale,
+                        (rec.x - padding) / textureWidth,
+                        (rec.y - padding) / textureHeight,
+                        (rec.x + rec.width + padding) / textureWidth,
+                        (rec.y + rec.height + padding) / textureHeight
+                    });
+                }
+
+                const float advance = glyph.advanceX != 0 ? static_cast<float>(glyph.advanceX) : rec.width;
+                penX += advance * scale + spacing;
+
+                lineWidth += glyph.advanceX > 0 ? static_cast<float>(glyph.advanceX) : rec.width + static_cast<float>(glyph.offsetX);
+                maxLineGlyphs = std::max(maxLineGlyphs, ++lineGlyphs);
+            }
+            maxLineWidth = std::max(maxLineWidth, lineWidth);
+
+            layout->size = Vector2{
+                maxLineWidth * scale + static_cast<float>(std::max(maxLineGlyphs - 1, 0)) * spacing,
+                height
+            };
+            layout->text = std::move(text);
+            return layout;
+        }
+    }
+
+    const TextLayout& CachedTextLayout::Resolve(const Font& font, std::string_view text, float fontSize, float spacing) {
+        if (!layout || !layout->Matches(font, text, fontSize, spacing)) {
+            layout = GetTextLayout(font, text, fontSize, spacing);
+        }
+        return *layout;
+    }
+
+    std::shared_ptr<const TextLayout> GetTextLayout(const Font& font, std::string_view text, float fontSize, float spacing) {
+        LayoutKey key{std::string(text), font.texture.id, font.recs, fontSize, spacing};
+
+        std::lock_guard lock(layoutCacheMutex);
+        if (auto it = layoutCache.find(key); it != layoutCache.end()) {
+            it->second.lastUsedFrame = currentFrame;
+            return it->second.layout;
+        }
+
+        auto layout = BuildLayout(font, key.text, fontSize, spacing);
+        layoutCache.emplace(std::move(key), CacheEntry{layout, currentFrame});
+        return layout;
+    }
+
+    void TrimTextLayoutCache() {
+        std::lock_guard lock(layoutCacheMutex);
+        ++currentFrame;
+        if (currentFrame % CACHE_EVICTION_FRAMES != 0) return;
+
+        // Holders keep their layout alive through the shared_ptr
+        std::erase_if(layoutCache, [](const auto& entry) {
+            return currentFrame - entry.second.lastUsedFrame > CACHE_EVICTION_FRAMES;
+        });
+    }
+
+    void ClearTextLayoutCache() {
+        std::lock_guard lock(layoutCacheMutex);
+        layoutCache.clear();
+    }
+
+    void DrawTextLayout(const Font& font, const TextLayout& layout, Vector2 position, Vector2 origin, float rotation, Color tint) {
+        DrawTexturedQuads(font.texture, layout.quads, position, origin, rotation, tint);
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef TEXTLAYOUT_H
+#define TEXTLAYOUT_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Defines.h"
+#include "Renderer.h"
+#include "raylib.h"
+
+namespace render {
+    // Glyph quads of a string, positioned relative to the text origin
+    struct TextLayout {
+        std::string text;
+        unsigned int fontTexture = 0;
+        const Rectangle* fontRecs = nullptr;
+        float fontSize = 0.0f;
+        float spacing = 0.0f;
+
+        std::vector<TexturedQuad> quads;
+        Vector2 size{0.0f, 0.0f};   // Matches MeasureTextEx
+
+        bool Matches(const Font& font, std::string_view otherText, float otherFontSize, float otherSpacing) const {
+            return fontTexture == font.texture.id && fontRecs == font.recs &&
+                   fontSize == otherFontSize && spacing == otherSpacing && text == otherText;
+        }
+    };
+
+    // Per-instance handle, only goes back to the cache when the text, font or size change
+    struct CachedTextLayout {
+        std::shared_ptr<const TextLayout> layout;
+
+        DLLEX const TextLayout& Resolve(const Font& font, std::string_view text, float fontSize, float spacing);
+    };
+
+    // Layouts are cached by (font, string, size, spacing) and dropped once unused for a while
+    DLLEX std::shared_ptr<const TextLayout> GetTextLayout(const Font& font, std::string_view text, float fontSize, float spacing);
+    DLLEX void TrimTextLayoutCache();
+    DLLEX void ClearTextLayoutCache();
+
+    DLLEX void DrawTextLayout(const Font& font, const TextLayout& layout, Vector2 position, Vector2 origin, float rotation, Color tint);
+}
+
+#endif //TEXTLAYOUT_H
@@ -0,0 +1,237 @@
+#include "TextureAtlas.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#include "Log.h"
+
+namespace atlas {
+    namespace {
+        constexpr u32 LAYOUT_MAGIC = 0x54414750; // "PGAT"
+        constexpr u32 LAYOUT_VERSION = 1;
+
+        template<typename T>
+        void WriteValue(std::ofstream& out, const T& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template<typename T>
+        bool ReadValue(std::ifstream& in, T& value) {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        void WriteString(std::ofstream& out, std::string_view value) {
+            WriteValue(out, static_cast<u16>(value.size()));
+            out.write(value.data(), static_cast<std::streamsize>(value.size()));
+        }
+
+        bool ReadString(std::ifstream& in, std::string& value) {
+            u16 length = 0;
+            if (!ReadValue(in, length)) return false;
+            value.resize(length);
+            return static_cast<bool>(in.read(value.data(), length));
+        }
+    }
+
+    SkylinePacker::SkylinePacker(i32 width, i32 height) :
+        pageWidth {width},
+        pageHeight {height}
+    {
+        skyline.push_back({0, 0, width});
+    }
+
+    i32 SkylinePacker::Fit(size_t index, i32 width, i32 height) const {
+        const i32 x = skyline[index].x;
+        if (x + width > pageWidth) return -1;
+
+        i32 y = skyline[index].y;
+        i32 remaining = width;
+        while (remaining > 0) {
+            if (index >= skyline.size()) return -1;
+            y = std::max(y, skyline[index].y);
+            if (y + height > pageHeight) return -1;
+            remaining -= skyline[index].width;
+            ++index;
+        }
+        return y;
+    }
+
+    void SkylinePacker::AddLevel(size_t index, i32 x, i32 y, i32 width, i32 height) {
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(index), Node{x, y + height, width});
+
+        // Trim the nodes now shadowed by the new level
+        for (size_t i = index + 1; i < skyline.size(); ) {
+            const Node& previous = skyline[i - 1];
+            const i32 previousEnd = previous.x + previous.width;
+            if (skyline[i].x >= previousEnd) break;
+
+            const i32 shrink = previousEnd - skyline[i].x;
+            skyline[i].x += shrink;
+            skyline[i].width -= shrink;
+            if (skyline[i].width > 0) break;
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+
+        // Merge neighbours resting at the same height
+        for (size_t i = 0; i + 1 < skyline.size(); ) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    bool SkylinePacker::Insert(i32 width, i32 height, i32& outX, i32& outY) {
+        i32 bestTop = std::numeric_limits<i32>::max();
+        i32 bestWidth = std::numeric_limits<i32>::max();
+        size_t bestIndex = skyline.size();
+
+        // Bottom-left heuristic: lowest resting top edge, then narrowest node
+        for (size_t i = 0; i < skyline.size(); ++i) {
+            const i32 y = Fit(i, width, height);
+            if (y < 0) continue;
+            const i32 top = y + height;
+            if (top < bestTop || (top == bestTop && skyline[i].width < bestWidth)) {
+                bestTop = top;
+                bestWidth = skyline[i].width;
+                bestIndex = i;
+                outY = y;
+            }
+        }
+
+        if (bestIndex == skyline.size()) return false;
+
+        outX = skyline[bestIndex].x;
+        AddLevel(bestIndex, outX, outY, width, height);
+        usedHeight = std::max(usedHeight, bestTop);
+        return true;
+    }
+
+    i32 Pack(std::span<const Entry> entries, std::vector<Placement>& placements) noexcept {
+        placements.assign(entries.size(), Placement{});
+
+        // Tallest first packs a skyline noticeably tighter
+        std::vector<size_t> order(entries.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::sort(order, [&entries](size_t a, size_t b) {
+            if (entries[a].height != entries[b].height) return entries[a].height > entries[b].height;
+            return entries[a].width > entries[b].width;
+        });
+
+        std::vector<SkylinePacker> pages;
+        for (const size_t index : order) {
+            const Entry& entry = entries[index];
+            Placement& placement = placements[index];
+
+            for (size_t page = 0; page < pages.size() && placement.page < 0; ++page) {
+                if (pages[page].Insert(entry.width + PADDING, entry.height + PADDING, placement.x, placement.y)) {
+                    placement.page = static_cast<i32>(page);
+                }
+            }
+
+            if (placement.page < 0) {
+                pages.emplace_back(PAGE_SIZE, PAGE_SIZE);
+                if (!pages.back().Insert(entry.width + PADDING, entry.height + PADDING, placement.x, placement.y)) {
+                    ENGINE_LOG(LOG_ERROR, "Atlas entry '%.*s' (%dx%d) does not fit in a page",
+                              static_cast<int>(entry.name.size()), entry.name.data(), entry.width, entry.height);
+                    pages.pop_back();
+                    continue;
+                }
+                placement.page = static_cast<i32>(pages.size() - 1);
+            }
+        }
+
+        return static_cast<i32>(pages.size());
+    }
+
+    i32 GetPageHeight(std::span<const Entry> entries, std::span<const Placement> placements, i32 page) noexcept {
+        i32 usedHeight = 1;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (placements[i].page == page) {
+                usedHeight = std::max(usedHeight, placements[i].y + entries[i].height + PADDING);
+            }
+        }
+
+        // Keep pages power-of-two for WebGL 1
+        i32 height = 1;
+        while (height < usedHeight) height <<= 1;
+        return std::min(height, PAGE_SIZE);
+    }
+
+    bool LoadLayout(const std::string& file, std::span<const Entry> entries, std::vector<Placement>& placements, i32& pageCount) noexcept {
+        std::ifstream in(file, std::ios::binary);
+        if (!in.is_open()) return false;
+
+        u32 magic = 0, version = 0, pageSize = 0, entryCount = 0;
+        i32 pages = 0;
+        if (!ReadValue(in, magic) || !ReadValue(in, version) || !ReadValue(in, pageSize) ||
+            !ReadValue(in, entryCount) || !ReadValue(in, pages)) {
+            return false;
+        }
+        // Every page holds at least one entry, more pages than entries means a corrupt file
+        if (magic != LAYOUT_MAGIC || version != LAYOUT_VERSION || pageSize != PAGE_SIZE || entryCount != entries.size() ||
+            pages < 0 || static_cast<u32>(pages) > entryCount) {
+            return false;
+        }
+
+        std::vector<Placement> cached(entries.size());
+        std::string name, path;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            i32 width = 0, height = 0;
+            if (!ReadString(in, name) || !ReadString(in, path) ||
+                !ReadValue(in, width) || !ReadValue(in, height) ||
+                !ReadValue(in, cached[i].page) || !ReadValue(in, cached[i].x) || !ReadValue(in, cached[i].y)) {
+                return false;
+            }
+
+            // Any change in the scene's texture set invalidates the whole layout
+            if (name != entries[i].name || path != entries[i].path ||
+                width != entries[i].width || height != entries[i].height ||
+                cached[i].page < 0 || cached[i].page >= pages) {
+                return false;
+            }
+
+            // Pixels are copied to exactly these coordinates, they have to lie inside the page
+            const Placement& placement = cached[i];
+            if (placement.x < 0 || placement.y < 0 ||
+                static_cast<i64>(placement.x) + width > PAGE_SIZE || static_cast<i64>(placement.y) + height > PAGE_SIZE) {
+                return false;
+            }
+        }
+
+        placements = std::move(cached);
+        pageCount = pages;
+        return true;
+    }
+
+    void SaveLayout(const std::string& file, std::span<const Entry> entries, std::span<const Placement> placements, i32 pageCount) noexcept {
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(file).parent_path(), error);
+
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            ENGINE_LOG(LOG_WARNING, "Could not write atlas layout cache: %s", file.c_str());
+            return;
+        }
+
+        WriteValue(out, LAYOUT_MAGIC);
+        WriteValue(out, LAYOUT_VERSION);
+        WriteValue(out, static_cast<u32>(PAGE_SIZE));
+        WriteValue(out, static_cast<u32>(entries.size()));
+        WriteValue(out, pageCount);
+        for (size_t i = 0; i < entries.size(); ++i) {
+            WriteString(out, entries[i].name);
+            WriteString(out, entries[i].path);
+            WriteValue(out, entries[i].width);
+            WriteValue(out, entries[i].height);
+            WriteValue(out, placements[i].page);
+            WriteValue(out, placements[i].x);
+            WriteValue(out, placements[i].y);
+        }
+    }
+}
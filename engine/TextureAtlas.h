@@ -0,0 +1,63 @@
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Defines.h"
+
+namespace atlas {
+    // Images larger than this on either axis keep their own texture
+    constexpr i32 MAX_ENTRY_SIZE = 256;
+    constexpr i32 PAGE_SIZE = 1024;
+    constexpr i32 PADDING = 2;
+
+    struct Entry {
+        std::string_view name;
+        std::string_view path;
+        i32 width;
+        i32 height;
+    };
+
+    struct Placement {
+        i32 page = -1;
+        i32 x = 0;
+        i32 y = 0;
+    };
+
+    // Skyline bottom-left rectangle packer for a single page
+    class SkylinePacker {
+    public:
+        SkylinePacker(i32 width, i32 height);
+
+        bool Insert(i32 width, i32 height, i32& outX, i32& outY);
+        i32 GetUsedHeight() const { return usedHeight; }
+
+    private:
+        struct Node {
+            i32 x, y, width;
+        };
+
+        // Returns the y the rectangle would rest at, or -1 if it does not fit
+        i32 Fit(size_t index, i32 width, i32 height) const;
+        void AddLevel(size_t index, i32 x, i32 y, i32 width, i32 height);
+
+        i32 pageWidth, pageHeight;
+        i32 usedHeight = 0;
+        std::vector<Node> skyline;
+    };
+
+    // Packs all entries into as few pages as possible. Placements are returned in entry order.
+    DLLEX i32 Pack(std::span<const Entry> entries, std::vector<Placement>& placements) noexcept;
+
+    // Height of the power-of-two page needed to hold every placement on the given page
+    DLLEX i32 GetPageHeight(std::span<const Entry> entries, std::span<const Placement> placements, i32 page) noexcept;
+
+    // Layout cache, so later loads can skip the packing step
+    DLLEX bool LoadLayout(const std::string& file, std::span<const Entry> entries, std::vector<Placement>& placements, i32& pageCount) noexcept;
+    DLLEX void SaveLayout(const std::string& file, std::span<const Entry> entries, std::span<const Placement> placements, i32 pageCount) noexcept;
+}
+
+#endif //TEXTUREATLAS_H
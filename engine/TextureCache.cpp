@@ -0,0 +1,159 @@
+#include "TextureCache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "AssetId.h"
+#include "Log.h"
+
+namespace texture_cache {
+    namespace {
+        constexpr u32 CACHE_MAGIC = 0x43544750; // "PGTC"
+        constexpr u32 CACHE_VERSION = 1;
+
+        struct Header {
+            u32 magic;
+            u32 version;
+            u64 sourceSize;
+            u64 sourceStamp;
+            i32 width;
+            i32 height;
+            i32 mipmaps;
+            i32 format;
+            u32 compressed;
+            u32 dataSize;       // Bytes stored after the header and path
+            u32 pixelSize;      // Bytes once decompressed
+            u32 pathLength;
+        };
+
+        // Far above any texture the game ships, and small enough that the size math can't overflow
+        constexpr i32 MAX_DIMENSION = 16384;
+
+        std::string CacheFile(std::string_view path) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "%016llx.tex", AssetId::Hash(path));
+            return std::string(CACHE_DIRECTORY) + name;
+        }
+
+        // Whether the header describes pixels raylib can read without running past the buffer.
+        // Save only ever writes one mip level.
+        bool ValidImage(const Header& header) {
+            if (header.width <= 0 || header.height <= 0 || header.width > MAX_DIMENSION || header.height > MAX_DIMENSION) {
+                return false;
+            }
+            if (header.format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE || header.format > PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) {
+                return false;
+            }
+            if (header.mipmaps != 1) return false;
+
+            const int pixelSize = GetPixelDataSize(header.width, header.height, header.format);
+            if (pixelSize <= 0 || header.pixelSize != static_cast<u32>(pixelSize)) return false;
+            return header.compressed || header.dataSize == header.pixelSize;
+        }
+
+        // Corrupt entries are deleted so they're rewritten on this load instead of failing every run
+        bool Discard(std::ifstream& in, const std::string& file) {
+            in.close();
+            std::error_code error;
+            std::filesystem::remove(file, error);
+            return false;
+        }
+    }
+
+    bool Load(std::string_view path, SourceStamp source, Image& image) noexcept {
+        const std::string file = CacheFile(path);
+        std::ifstream in(file, std::ios::binary);
+        if (!in.is_open()) return false;
+
+        Header header{};
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) return Discard(in, file);
+        if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION ||
+            header.sourceSize != source.size || header.sourceStamp != source.stamp ||
+            header.pathLength != path.size()) {
+            return false;
+        }
+
+        // Guards against two paths sharing a file name hash
+        std::string storedPath(header.pathLength, '\0');
+        if (!in.read(storedPath.data(), header.pathLength) || storedPath != path) return false;
+        if (!ValidImage(header)) return Discard(in, file);
+
+        // A truncated write or a bad dataSize shows up as the wrong file size
+        std::error_code error;
+        const u64 fileSize = std::filesystem::file_size(file, error);
+        if (error || fileSize != sizeof(header) + static_cast<u64>(header.pathLength) + header.dataSize) {
+            return Discard(in, file);
+        }
+
+        auto* data = static_cast<u8*>(MemAlloc(header.dataSize));
+        if (data == nullptr) return false;
+        if (!in.read(reinterpret_cast<char*>(data), header.dataSize)) {
+            MemFree(data);
+            return Discard(in, file);
+        }
+
+        if (header.compressed) {
+            int pixelSize = 0;
+            u8* pixels = DecompressData(data, static_cast<int>(header.dataSize), &pixelSize);
+            MemFree(data);
+            if (pixels == nullptr || static_cast<u32>(pixelSize) != header.pixelSize) {
+                MemFree(pixels);
+                return Discard(in, file);
+            }
+            data = pixels;
+        }
+
+        image = Image{data, header.width, header.height, header.mipmaps, header.format};
+        return true;
+    }
+
+    void Save(std::string_view path, SourceStamp source, const Image& image) noexcept {
+        if (image.data == nullptr) return;
+
+        const int pixelSize = GetPixelDataSize(image.width, image.height, image.format);
+        const u8* data = static_cast<const u8*>(image.data);
+        int dataSize = pixelSize;
+        u8* compressed = nullptr;
+        if constexpr (COMPRESS) {
+            compressed = CompressData(data, pixelSize, &dataSize);
+            if (compressed == nullptr) return;
+            data = compressed;
+        }
+
+        const Header header{
+            CACHE_MAGIC, CACHE_VERSION,
+            source.size, source.stamp,
+            image.width, image.height, 1, image.format,
+            COMPRESS ? 1u : 0u,
+            static_cast<u32>(dataSize), static_cast<u32>(pixelSize),
+            static_cast<u32>(path.size())
+        };
+
+        std::error_code error;
+        std::filesystem::create_directories(CACHE_DIRECTORY, error);
+
+        // Written under a unique name and renamed, so a concurrent reader never sees half a file
+        static std::atomic<u32> tempCounter{0};
+        const std::string file = CacheFile(path);
+        const std::string tempFile = file + ".tmp" + std::to_string(tempCounter.fetch_add(1));
+        bool written = false;
+        {
+            std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+            if (out.is_open()) {
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                out.write(path.data(), static_cast<std::streamsize>(path.size()));
+                out.write(reinterpret_cast<const char*>(data), dataSize);
+                written = static_cast<bool>(out);
+            }
+        }
+        MemFree(compressed);
+
+        if (written) std::filesystem::rename(tempFile, file, error);
+        if (!written || error) {
+            ENGINE_LOG(LOG_WARNING, "Could not write texture cache: %s", file.c_str());
+            std::filesystem::remove(tempFile, error);
+        }
+    }
+}
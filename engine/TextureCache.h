@@ -0,0 +1,32 @@
+#ifndef TEXTURECACHE_H
+#define TEXTURECACHE_H
+
+#include <string>
+#include <string_view>
+
+#include "Defines.h"
+#include "raylib.h"
+
+// On-disk cache of decoded image pixels, so unchanged PNGs skip stb_image on later runs.
+// Entries are keyed by asset path and validated against the source's size and stamp
+// (modification time for loose files, pack offset and pack modification time for packed ones).
+namespace texture_cache {
+    constexpr const char* CACHE_DIRECTORY = "cache/textures/";
+
+    // DEFLATE shrinks the files ~10x but inflating costs about as much as decoding the PNG
+    constexpr bool COMPRESS = false;
+
+    struct SourceStamp {
+        u64 size;
+        u64 stamp;
+    };
+
+    // Fills `image` from a fresh cache entry. The pixels are owned by the caller (UnloadImage).
+    // Entries that are truncated or describe an impossible image are deleted and count as a miss.
+    DLLEX bool Load(std::string_view path, SourceStamp source, Image& image) noexcept;
+
+    // Writes `image` for later runs. Safe to call from several threads at once.
+    DLLEX void Save(std::string_view path, SourceStamp source, const Image& image) noexcept;
+}
+
+#endif //TEXTURECACHE_H
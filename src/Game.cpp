@@ -12,15 +12,22 @@
 
 // Initialize static members
 std::vector<std::unique_ptr<IScene>> Game::scenes;
+std::vector<Game::PendingSceneChange> Game::pendingSceneChanges;
+std::mutex Game::pendingSceneMutex;
 Game* Game::instance = nullptr;
 
 void Game::Load() {
     instance = this;
     auto startScene = std::make_unique<SceneMainMenu>();
     AddScene(std::move(startScene));
+    ApplySceneChanges();
 }
 
 void Game::Unload() {
+    {
+        std::lock_guard lock(pendingSceneMutex);
+        pendingSceneChanges.clear();
+    }
     for (auto&& scene : std::ranges::reverse_view(scenes)) {
         scene->Unload();
     }
@@ -57,20 +64,52 @@ void Game::Draw() {
     }
 }
 
+void Game::PublishFrame() {
+    for (auto&& scene : std::ranges::reverse_view(scenes)) {
+        scene->PublishFrame();
+        if (scene->GetTransparent()) break;
+    }
+}
+
+void Game::SyncFrame() {
+    for (auto&& scene : scenes) {
+        scene->SyncFrame();
+    }
+    ApplySceneChanges();
+}
+
 void Game::AddScene(std::unique_ptr<IScene> newScene) {
-    scenes.emplace_back(std::move(newScene));
-    scenes.back()->Load();
+    std::lock_guard lock(pendingSceneMutex);
+    pendingSceneChanges.push_back({std::move(newScene)});
 }
 
 void Game::RemoveTopScene() {
-    if (scenes.empty()) return;
-    scenes.back()->Unload();
-    scenes.pop_back();
+    std::lock_guard lock(pendingSceneMutex);
+    pendingSceneChanges.push_back({nullptr});
 }
 
 void Game::SwitchScene(std::unique_ptr<IScene> newScene) {
-    if (!scenes.empty()) {
-        RemoveTopScene();
+    std::lock_guard lock(pendingSceneMutex);
+    pendingSceneChanges.push_back({nullptr});
+    pendingSceneChanges.push_back({std::move(newScene)});
+}
+
+void Game::ApplySceneChanges() {
+    std::vector<PendingSceneChange> changes;
+    {
+        std::lock_guard lock(pendingSceneMutex);
+        changes.swap(pendingSceneChanges);
+    }
+
+    for (auto& change : changes) {
+        if (change.scene) {
+            scenes.emplace_back(std::move(change.scene));
+            scenes.back()->Load();
+            // Publish right away so the next Draw has something to show
+            scenes.back()->PublishFrame();
+        } else if (!scenes.empty()) {
+            scenes.back()->Unload();
+            scenes.pop_back();
+        }
     }
-    AddScene(std::move(newScene));
 }
@@ -6,7 +6,9 @@
 #define GAME_H
 
 #include <memory>
+#include <mutex>
 #include "IGame.h"
+#include "AssetManager.h"
 #include <vector>
 #include "scenes/IScene.h"
 
@@ -19,12 +21,34 @@ public:
     void AsyncUpdate(float d_time) override;  // This will run in worker threads
     void Draw() override;
 
+    bool SupportsPipelining() const override { return true; }
+    void PublishFrame() override;
+    void SyncFrame() override;
+
+    // Scene changes are queued and applied at the end of the frame, so a scene
+    // is never destroyed while its own systems are still running
     static void AddScene(std::unique_ptr<IScene> newScene);
     static void RemoveTopScene();
     static void SwitchScene(std::unique_ptr<IScene> newScene);
 
+    // Streams the manifest of scene T on the worker threads while the current scene runs,
+    // so switching to T later only activates resident assets. Call from a scene's Load or Update.
+    template<typename T>
+    static void PreloadScene() {
+        AssetManager::PreloadManifest(T::ASSET_MANIFEST, T::SCENE_NAME);
+    }
+
 private:
+    // A null scene pops the top of the stack
+    struct PendingSceneChange {
+        std::unique_ptr<IScene> scene;
+    };
+
+    static void ApplySceneChanges();
+
     static std::vector<std::unique_ptr<IScene>> scenes;
+    static std::vector<PendingSceneChange> pendingSceneChanges;
+    static std::mutex pendingSceneMutex;
     static Game* instance;
 };
 
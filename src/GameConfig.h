@@ -13,8 +13,7 @@
 #define GAME_WIDTH 800
 #define GAME_HEIGHT 600
 
-// Game title
-#define GAME_TITLE "A Plane Game"
+// Game title: see UiText.h
 
 // ------------------------------------------------------
 
@@ -39,12 +38,24 @@
 #define BULLET_BASE_WIDTH 3.0f
 #define BULLET_BASE_HEIGHT 5.0f
 
+// Collision configuration
+#define COLLISION_GRID_CELL_SIZE 32.0f  // A bit above ENEMY_SPRITE_SIZE, so an enemy touches at most 4 cells
+
+// Render configuration
+#define RENDER_GRID_CELL_SIZE 64.0f     // Cull grid for cached layers, see RenderCullIndex
+
+// Background configuration
+#define BACKGROUND_TILE_SIZE 16
+#define BACKGROUND_ROWS 32
+#define BACKGROUND_SCROLL_SPEED 12.0f
+
 // UI configuration
 #define UI_MAIN_MENU_FONT_SIZE 7
 #define UI_DEFAULT_FONT_SIZE 14
 
 // Engine configuration
 #define ENGINE_FIXED_TIME_STEP 0.02f
+#define ENGINE_ASSET_MEMORY_BUDGET_MB 256
 #define ENGINE_MAX_QUEUED_TASKS 1000
 
 // Common game assets
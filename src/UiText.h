@@ -0,0 +1,14 @@
+#ifndef UITEXT_H
+#define UITEXT_H
+
+// Every string the game draws with a loaded font. font_baker bakes the glyphs of the literals in
+// this file (and of the tables under assets/text/) and nothing else, so text drawn with a loaded
+// font belongs here; anything missing from the bake renders as '?'.
+
+#define GAME_TITLE "A Plane Game"
+
+// Main menu
+#define UI_TEXT_INSERT_CREDIT "INSERT CREDIT(S)"
+#define UI_TEXT_PRESS_ENTER "OR PRESS ENTER"
+
+#endif //UITEXT_H
@@ -0,0 +1,30 @@
+#ifndef COLLIDERCOMPONENT_H
+#define COLLIDERCOMPONENT_H
+
+#include "IComponent.h"
+#include "raylib.h"
+
+enum class CollisionLayer : u8 {
+    Player,
+    Enemy,
+    PlayerBullet,       // The bullet layers are filled from the BulletPool, not from entities
+    EnemyBullet,
+    Count
+};
+
+constexpr u32 LayerBit(CollisionLayer layer) { return 1u << static_cast<u32>(layer); }
+
+// An entity that takes part in collision detection. A collider sits on one layer and reports
+// hits with the layers in its mask; pairs neither side asks for are never tested.
+struct ColliderComponent : public IComponent {
+    ColliderComponent() = default;
+    ColliderComponent(CollisionLayer layer, u32 mask) : layer{layer}, mask{mask} {}
+
+    CollisionLayer layer = CollisionLayer::Enemy;
+    u32 mask = 0;           // LayerBit of every layer this collider hits
+    Vector2 size{0, 0};     // Bounds centred on the transform, zero uses the sprite size
+    Vector2 sweep{0, 0};    // Distance moved this frame, ending at the transform. Set by whatever
+                            // moves the collider, so fast movers are tested along their path
+};
+
+#endif //COLLIDERCOMPONENT_H
@@ -6,7 +6,10 @@
 #define DRAWINGCOMPONENT_H
 
 #include "GameConfig.h"
+#include "AssetManager.h"
 #include "IComponent.h"
+#include "TextLayout.h"
+#include "RenderTargetPool.h"
 #include <string_view>
 
 struct TextComponent : public IComponent {
@@ -21,6 +24,9 @@ struct TextComponentPro : public IComponent {
     int fontSize;
     float spacing;
     Color tint;
+
+    // Glyph quads, rebuilt by the renderer only when the text or font settings change
+    mutable render::CachedTextLayout layout;
 };
 
 struct TextComponentPixelPerfect : public TextComponentPro {};
@@ -35,28 +41,58 @@ struct RectangleComponent : public IComponent {
 };
 
 struct SpriteComponent : public IComponent {
-    const Texture* texture = nullptr;  // Changed from reference to pointer
+    AssetManager::TextureHandle texture;  // Survives the texture being evicted and reloaded
+    Rectangle source{0,0,0,0};         // Region of the texture to draw, empty means the whole texture
     Vector2 size{1,1};
     Vector2 origin{0,0};
     Color tint{WHITE};
 };
 
+// Flip-book animation over a texture added with AddSceneAnimatedTexture. AnimationSystem
+// advances it and writes the current frame into the entity's SpriteComponent.source.
+struct AnimatedSpriteComponent : public IComponent {
+    AssetId animation;
+    float frameDuration = 0.1f;         // Seconds per frame, <= 0 pauses
+    bool loop = true;
+    i32 frame = 0;
+    float elapsed = 0.0f;
+
+    // Resolved from `animation` by AnimationSystem; generation 0 means not resolved yet
+    u32 frameCount = 0;
+    u32 generation = 0;
+};
+
+// Cached layers are rendered once into their own texture and only redrawn when
+// something on them changes; Dynamic is redrawn every frame.
+enum class RenderLayer : u8 {
+    Background,
+    Dynamic,
+    Hud,
+    Count
+};
+
+struct RenderLayerComponent : public IComponent {
+    RenderLayerComponent() = default;
+    explicit RenderLayerComponent(RenderLayer layer) : layer{layer} {}
+
+    RenderLayer layer = RenderLayer::Dynamic;
+};
+
 struct PixelPerfectCameraComponent : public IComponent {
     Camera2D worldSpaceCamera;  // Game world camera
     Camera2D screenSpaceCamera; // Smoothing camera
     RenderTexture2D target;     // Render texture for the game world
 
-    // Source and destination rectangles for rendering
+    // Source rectangle for drawing the target; RenderSystem letterboxes it to the window each frame
     Rectangle sourceRec;
-    Rectangle destRec;
     
     void OnCreate() override {
         // Initialize cameras with default settings
         worldSpaceCamera = Camera2D{};
         screenSpaceCamera = Camera2D{};
         
-        // Initialize the render texture
-        target = LoadRenderTexture(VIRTUAL_WIDTH, VIRTUAL_HEIGHT);
+        // Pooled, so switching scenes reuses the same framebuffer
+        target = render::AcquireRenderTarget(VIRTUAL_WIDTH, VIRTUAL_HEIGHT);
         
         // Set up source rectangle (flipped for OpenGL)
         sourceRec = { 
@@ -65,13 +101,11 @@ struct PixelPerfectCameraComponent : public IComponent {
             static_cast<float>(target.texture.width), 
             -static_cast<float>(target.texture.height) 
         };
-        
-        // Initial destination rectangle will be updated by RenderSystem
-        destRec = { 0.0f, 0.0f, static_cast<float>(VIRTUAL_WIDTH), static_cast<float>(VIRTUAL_HEIGHT) };
     }
     
     void OnDestroy() override {
-        UnloadRenderTexture(target);
+        render::ReleaseRenderTarget(target);
+        target = RenderTexture2D{};
     }
 };
 
@@ -27,16 +27,6 @@ struct PlayerComponent : public IComponent {
     u64 score = 0;
 };
 
-struct BulletComponent : public IComponent {
-    u8 bulletDamage = PLAYER_DEFAULT_BULLET_DAMAGE;
-    u8 bulletSpeed = PLAYER_DEFAULT_BULLET_SPEED;
-    u8 bulletSize = PLAYER_DEFAULT_BULLET_SIZE;
-    float angle = 0.0f;  // Angle in degrees
-    BulletType type = BulletType::Player;
-
-    u64 score = 0;
-};
-
 struct EnemyComponent : public IComponent {
     i8 health = ENEMY_DEFAULT_HEALTH;  // Default health
     float moveSpeed = ENEMY_MOVE_SPEED;  // Slower than player
@@ -0,0 +1,37 @@
+#ifndef TILEMAPCOMPONENT_H
+#define TILEMAPCOMPONENT_H
+
+#include "IComponent.h"
+#include "AssetId.h"
+#include "Renderer.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Prebuilt quads of one chunk, in chunk-local coordinates
+struct TilemapChunk {
+    std::shared_ptr<const std::vector<render::TexturedQuad>> quads;
+    u64 lastVisibleFrame = 0;
+};
+
+// A grid of tiles drawn from a tiled texture. The map's top-left corner sits at the
+// entity's TransformComponent position; rotation is ignored.
+struct TilemapComponent : public IComponent {
+    static constexpr i32 CHUNK_SIZE = 16;        // Tiles per chunk side
+    static constexpr u16 EMPTY_TILE = 0xFFFF;
+
+    AssetId tileset;                // Tiled texture in the AssetManager
+    i32 width = 0;                  // Map size in tiles
+    i32 height = 0;
+    Vector2 tileSize{16, 16};       // World size of one tile
+    std::vector<u16> tiles;         // Row-major indices into the tileset's UV table
+    bool repeatRows = false;        // Map repeats vertically, for endless scrolling
+    float scrollSpeed = 0.0f;       // World units per second the map moves down
+    Color tint{WHITE};
+
+    // Visible chunks, managed by TilemapSystem
+    mutable std::unordered_map<u64, TilemapChunk> chunks;
+    mutable u64 frame = 0;
+};
+
+#endif //TILEMAPCOMPONENT_H
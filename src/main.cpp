@@ -1,6 +1,8 @@
 #include "Game.h"
 #include "../engine/Engine.h"
+#include "AssetManager.h"
 #include "GameConfig.h"
+#include "UiText.h"
 
 int main() {
     unique_ptr<Game> game = std::make_unique<Game>();
@@ -8,7 +10,9 @@ int main() {
     Engine engine;
     Engine::SetProfilingEnabled(false);
     Engine::SetFrameStatsEnabled(false);  // Disable frame stats reporting
+    AssetManager::SetMemoryBudget(ENGINE_ASSET_MEMORY_BUDGET_MB * 1024ull * 1024ull);
     //Engine::SetProfilingEnabled(true, 165*2);
+    //Engine::SetPipelinedRendering(true);  // Simulate the next frame while the last one renders
     engine.Start(GAME_WIDTH, GAME_HEIGHT, GAME_TITLE, std::move(game));
 
     return 0;
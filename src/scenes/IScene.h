@@ -28,6 +28,9 @@ public:
     virtual void FixedUpdate(float fixed_d_time) {}
     virtual void AsyncUpdate(float d_time) {}
     virtual void Draw() {}
+    virtual void PublishFrame() {}  // Hands this frame's render state to Draw
+
+    virtual void SyncFrame() {}     // Runs at the end of the frame while no system is iterating
 
     bool GetLocking() const { return isLocking; }
     bool GetTransparent() const { return isTransparent; }
@@ -6,6 +6,8 @@
 #include "GameConfig.h"
 #include "systems/BulletSystem.h"
 #include "systems/CollisionSystem.h"
+#include "systems/CommandBuffer.h"
+#include "systems/DamageSystem.h"
 
 SceneGame::~SceneGame() {
     Unload();
@@ -27,17 +29,39 @@ void SceneGame::Load() {
         [](entt::registry& reg, float dt) { CollisionSystem::Update(reg, dt); },
         SystemManager::UpdateType::Update
     );
+
+    systemManager.AddSystem(
+        [](entt::registry& reg, float dt) { DamageSystem::Update(reg, dt); },
+        SystemManager::UpdateType::Update
+    );
+
+    systemManager.AddSystem(
+        [](entt::registry& reg, float dt) { TilemapSystem::Update(reg, dt); },
+        SystemManager::UpdateType::Update
+    );
     
+    systemManager.AddSystem(
+        [](entt::registry& reg, float dt) { RenderSystem::Publish(reg); },
+        SystemManager::UpdateType::Publish
+    );
+
     systemManager.AddSystem(
         [](entt::registry& reg, float dt) { RenderSystem::DrawPixelPerfect(reg); },
         SystemManager::UpdateType::Draw
     );
 
+    AssetManager::LoadManifest(ASSET_MANIFEST, SCENE_NAME);
+
+    // Systems defer destroys and component changes until PublishFrame
+    registry.ctx().emplace<CommandBuffer>();
+
     // Initialize systems that need it
-    BulletSystem::Initialize( SCENE_NAME );
+    BulletSystem::Initialize(registry);
 
+    RenderSystem::Initialize(registry);
     SetupCamera();
 
+    backgroundSpawned = false;
     SpawnPlayer();
     SpawnEnemy();  // Spawn an enemy after the player
     LOG_DEBUG("Loaded the Game Scene");
@@ -45,6 +69,7 @@ void SceneGame::Load() {
 
 void SceneGame::Unload() {
     systemManager.ClearAllSystems();
+    RenderSystem::Shutdown(registry);
     AssetManager::RemoveSceneTextures(SCENE_NAME);
     LOG_DEBUG("Unloaded the Game Scene");
 }
@@ -52,6 +77,11 @@ void SceneGame::Unload() {
 void SceneGame::Update(float d_time) {
     // Regular update - runs every frame
     // Good for visual updates, input handling, etc.
+    if (!backgroundSpawned && AssetManager::GetLoadState("background") == AssetManager::LoadState::Loaded) {
+        SpawnBackground();
+        backgroundSpawned = true;
+    }
+
     systemManager.ExecuteSystems(SystemManager::UpdateType::Update, registry, d_time);
 }
 
@@ -72,6 +102,13 @@ void SceneGame::Draw() {
     systemManager.ExecuteSystems(SystemManager::UpdateType::Draw, registry, 0.0f);
 }
 
+void SceneGame::PublishFrame() {
+    // Update is done with the registry, and applying before the snapshot is taken keeps
+    // entities destroyed this frame from being drawn once more
+    registry.ctx().get<CommandBuffer>().Apply(registry);
+    systemManager.ExecuteSystems(SystemManager::UpdateType::Publish, registry, 0.0f);
+}
+
 void SceneGame::SetupCamera() {
     // Create the pixel-perfect camera entity
     auto cameraEntity = registry.create();
@@ -93,15 +130,40 @@ void SceneGame::SetupCamera() {
     camera.screenSpaceCamera.rotation = 0.0f;
 }
 
+void SceneGame::SpawnBackground() {
+    auto background = registry.create();
+
+    registry.emplace<TransformComponent>(background);
+    auto& tilemap = registry.emplace<TilemapComponent>(background);
+
+    tilemap.tileset = BACKGROUND_TEXTURE;
+    tilemap.width = VIRTUAL_WIDTH / BACKGROUND_TILE_SIZE;
+    tilemap.height = BACKGROUND_ROWS;
+    tilemap.tileSize = Vector2{BACKGROUND_TILE_SIZE, BACKGROUND_TILE_SIZE};
+    tilemap.repeatRows = true;
+    tilemap.scrollSpeed = BACKGROUND_SCROLL_SPEED;
+
+    // Scatter tiles cut from the solid middle of the background image
+    const auto& tileset = AssetManager::GetTextureData(BACKGROUND_TEXTURE);
+    const int centerColumn = tileset.tileGrid.x / 2;
+    const int centerRow = tileset.tileGrid.y / 2;
+    tilemap.tiles.resize(static_cast<size_t>(tilemap.width) * tilemap.height);
+    for (auto& tile : tilemap.tiles) {
+        const int column = centerColumn + GetRandomValue(-3, 2);
+        const int row = centerRow + GetRandomValue(-3, 2);
+        tile = static_cast<u16>(row * tileset.tileGrid.x + column);
+    }
+}
+
 void SceneGame::SpawnPlayer() {
     auto player = registry.create();
 
     auto& transform = registry.emplace<TransformComponent>(player);
     auto& player_comp = registry.emplace<PlayerComponent>(player);
     auto& player_immage = registry.emplace<SpriteComponent>(player);
+    registry.emplace<ColliderComponent>(player, CollisionLayer::Player, 0u);  // Enemy bullets ask for the hit
 
-    AssetManager::AddSceneTexture("player", "bomber_one.png", SCENE_NAME);
-    auto& texture = AssetManager::GetTexture("player");
+    const Rectangle source = AssetManager::GetTextureFrame(PLAYER_TEXTURE, 0).second;
 
     // Define the desired sprite size
     player_immage.size.x = PLAYER_SPRITE_SIZE;
@@ -112,7 +174,8 @@ void SceneGame::SpawnPlayer() {
     transform.position.y = VIRTUAL_HEIGHT - (player_immage.size.y/2.0f + 5.0f);  // Center of virtual height
 
     // Set the source rectangle to use the entire texture
-    player_immage.texture = &texture;
+    player_immage.texture = AssetManager::GetTextureHandle(PLAYER_TEXTURE);
+    player_immage.source = source;
     player_immage.tint = WHITE;  // Use white tint to show original colors
 
     // Log player spawn info
@@ -125,10 +188,10 @@ void SceneGame::SpawnEnemy() {
     auto& transform = registry.emplace<TransformComponent>(enemy);
     auto& enemy_comp = registry.emplace<EnemyComponent>(enemy);
     auto& enemy_image = registry.emplace<SpriteComponent>(enemy);
+    registry.emplace<ColliderComponent>(enemy, CollisionLayer::Enemy, 0u);  // Player bullets ask for the hit
 
     // Reuse player texture but make enemy smaller
-    AssetManager::AddSceneTexture("enemy", "bomber_one.png", SCENE_NAME);
-    auto& texture = AssetManager::GetTexture("enemy");
+    const Rectangle source = AssetManager::GetTextureFrame(ENEMY_TEXTURE, 0).second;
 
     // Define the desired sprite size (smaller than player)
     enemy_image.size.x = ENEMY_SPRITE_SIZE;
@@ -140,7 +203,8 @@ void SceneGame::SpawnEnemy() {
     transform.rotation = 180.0f;  // Rotate 180 degrees to face downward
 
     // Set the source rectangle to use the entire texture
-    enemy_image.texture = &texture;
+    enemy_image.texture = AssetManager::GetTextureHandle(ENEMY_TEXTURE);
+    enemy_image.source = source;
     enemy_image.tint = RED;  // Make enemy red to distinguish it
     enemy_image.origin = Vector2{ enemy_image.size.x, enemy_image.size.y };  // Set origin to center for rotation
 
@@ -13,7 +13,9 @@
 #include "systems/MovementSystem.h"
 #include "systems/RenderSystem.h"
 #include "systems/BulletSystem.h"
+#include "systems/TilemapSystem.h"
 #include "systems/SystemManager.h"
+#include "GameConfig.h"
 
 class SceneGame final : public IScene {
 public:
@@ -25,14 +27,29 @@ public:
     void FixedUpdate(float fixed_d_time) override;
     void AsyncUpdate(float d_time) override;
     void Draw() override;
+    void PublishFrame() override;
+
+    static constexpr i32 SCENE_NAME = ToSceneId(SceneName::SceneGame);
+
+    // Small sprites share atlas pages so they don't break the draw batch. The background is
+    // the largest image and streams in after the scene starts unless it was preloaded.
+    static constexpr AssetManager::ManifestEntry ASSET_MANIFEST[] = {
+        AssetManager::ManifestEntry::AtlasedTexture("player", "bomber_one.png"),
+        AssetManager::ManifestEntry::AtlasedTexture("enemy", "bomber_one.png"),
+        BulletSystem::BULLET_ASSET,
+        AssetManager::ManifestEntry::StreamedTiles("background", "bg.png", {BACKGROUND_TILE_SIZE, BACKGROUND_TILE_SIZE}),
+    };
 
 protected:
     void SetupCamera();
+    void SpawnBackground();
     void SpawnPlayer();
     void SpawnEnemy();
-    entt::registry registry;
     SystemManager systemManager;
-    static constexpr i32 SCENE_NAME = ToSceneId(SceneName::SceneGame);
+    bool backgroundSpawned = false;  // The background streams in after the scene starts
+    static constexpr AssetId PLAYER_TEXTURE{"player"};
+    static constexpr AssetId ENEMY_TEXTURE{"enemy"};
+    static constexpr AssetId BACKGROUND_TEXTURE{"background"};
 };
 
 
@@ -10,6 +10,7 @@
 #include "scenes/SceneGame.h"
 #include "raylib.h"
 #include "GameConfig.h"
+#include "UiText.h"
 #include "systems/MenuSystem.h"
 #include "systems/RenderSystem.h"
 #include "AssetManager.h"
@@ -21,21 +22,29 @@ void SceneMainMenu::Load() {
         SystemManager::UpdateType::Update
     );
     
+    systemManager.AddSystem(
+        [](entt::registry& reg, float dt) { RenderSystem::Publish(reg); },
+        SystemManager::UpdateType::Publish
+    );
+
     systemManager.AddSystem(
         [](entt::registry& reg, float dt) { RenderSystem::DrawPixelPerfect(reg); },
         SystemManager::UpdateType::Draw
     );
 
-    // Load the Lander font
-    AssetManager::AddSceneFont("lander", FONT_LANDER, SCENE_NAME, UI_MAIN_MENU_FONT_SIZE);
-    AssetManager::AddSceneFont("lander_bold", FONT_LANDER_BOLD, SCENE_NAME, UI_MAIN_MENU_FONT_SIZE);
+    AssetManager::LoadManifest(ASSET_MANIFEST, SCENE_NAME);
 
+    RenderSystem::Initialize(registry);
     SetupMenuEntities();
+
+    // The menu only ever leads into the game, so its assets stream in while the menu waits for Enter
+    Game::PreloadScene<SceneGame>();
     LOG_DEBUG("Loaded the Main Menu scene");
 }
 
 void SceneMainMenu::Unload() {
     systemManager.ClearAllSystems();
+    RenderSystem::Shutdown(registry);
     AssetManager::RemoveSceneTextures(SCENE_NAME);
     LOG_DEBUG("Unloaded the Main Menu scene");
 }
@@ -48,6 +57,10 @@ void SceneMainMenu::Draw() {
     systemManager.ExecuteSystems(SystemManager::UpdateType::Draw, registry, 0.0f);
 }
 
+void SceneMainMenu::PublishFrame() {
+    systemManager.ExecuteSystems(SystemManager::UpdateType::Publish, registry, 0.0f);
+}
+
 void SceneMainMenu::SetupMenuEntities() {
     // Create camera entity
     auto cameraEntity = registry.create();
@@ -74,6 +87,7 @@ void SceneMainMenu::SetupMenuEntities() {
     auto titleEntity = registry.create();
     auto& titleTransform = registry.emplace<TransformComponent>(titleEntity);
     auto& titleText = registry.emplace<TextComponentPixelPerfect>(titleEntity);
+    registry.emplace<RenderLayerComponent>(titleEntity, RenderLayer::Background);
     
     titleText.text = GAME_TITLE;
     titleText.font = landerBoldFont;
@@ -81,8 +95,8 @@ void SceneMainMenu::SetupMenuEntities() {
     titleText.spacing = 1.0f;
     titleText.tint = DARKPURPLE;
     
-    // Center the title using MeasureTextEx with the Lander font
-    Vector2 titleSize = MeasureTextEx(landerFont, std::string(titleText.text).c_str(), titleText.fontSize, titleText.spacing);
+    // Center the title using its cached layout, which the renderer reuses
+    const Vector2 titleSize = titleText.layout.Resolve(titleText.font, titleText.text, titleText.fontSize, titleText.spacing).size;
     titleTransform.position = Vector2{
         (VIRTUAL_WIDTH - titleSize.x) / 2.0f,
         VIRTUAL_HEIGHT / 3.0f
@@ -92,15 +106,16 @@ void SceneMainMenu::SetupMenuEntities() {
     auto startTextEntity = registry.create();
     auto& startTransform = registry.emplace<TransformComponent>(startTextEntity);
     auto& startText = registry.emplace<TextComponentPixelPerfect>(startTextEntity);
+    registry.emplace<RenderLayerComponent>(startTextEntity, RenderLayer::Hud);
     
-    startText.text = "INSERT CREDIT(S)";
+    startText.text = UI_TEXT_INSERT_CREDIT;
     startText.font = landerBoldFont;
     startText.fontSize = UI_MAIN_MENU_FONT_SIZE;
     startText.spacing = 1.0f;
     startText.tint = BLACK;
     
-    // Center the start text using MeasureTextEx with the Lander font
-    Vector2 startSize = MeasureTextEx(landerFont, std::string(startText.text).c_str(), startText.fontSize, startText.spacing);
+    // Center the start text using its cached layout, which the renderer reuses
+    const Vector2 startSize = startText.layout.Resolve(startText.font, startText.text, startText.fontSize, startText.spacing).size;
     startTransform.position = Vector2{
         (VIRTUAL_WIDTH - startSize.x) / 2.0f,
         VIRTUAL_HEIGHT * 2.0f / 3.0f - 2.0f
@@ -110,15 +125,16 @@ void SceneMainMenu::SetupMenuEntities() {
     auto enterTextEntity = registry.create();
     auto& enterTransform = registry.emplace<TransformComponent>(enterTextEntity);
     auto& enterText = registry.emplace<TextComponentPixelPerfect>(enterTextEntity);
+    registry.emplace<RenderLayerComponent>(enterTextEntity, RenderLayer::Hud);
     
-    enterText.text = "OR PRESS ENTER";
+    enterText.text = UI_TEXT_PRESS_ENTER;
     enterText.font = landerFont;
     enterText.fontSize = UI_MAIN_MENU_FONT_SIZE;
     enterText.spacing = 1.0f;
     enterText.tint = BLACK;
     
-    // Center the enter text using MeasureTextEx with the Lander font
-    Vector2 enterSize = MeasureTextEx(landerFont, std::string(enterText.text).c_str(), enterText.fontSize, enterText.spacing);
+    // Center the enter text using its cached layout, which the renderer reuses
+    const Vector2 enterSize = enterText.layout.Resolve(enterText.font, enterText.text, enterText.fontSize, enterText.spacing).size;
     enterTransform.position = Vector2{
         (VIRTUAL_WIDTH - enterSize.x) / 2.0f,
         VIRTUAL_HEIGHT * 2.0f / 3.0f + startText.fontSize
@@ -6,6 +6,8 @@
 #define SCENEMAINMENU_H
 
 #include "IScene.h"
+#include "AssetManager.h"
+#include "GameConfig.h"
 #include "Renderer.h"
 #include "components/DrawingComponent.h"
 #include "systems/SystemManager.h"
@@ -17,11 +19,18 @@ public:
     void Unload() override;
     void Update(float d_time) override;
     void Draw() override;
+    void PublishFrame() override;
+
+    static constexpr i32 SCENE_NAME = ToSceneId(SceneName::SceneMainMenu);
+
+    static constexpr AssetManager::ManifestEntry ASSET_MANIFEST[] = {
+        AssetManager::ManifestEntry::TextFont("lander", FONT_LANDER, UI_MAIN_MENU_FONT_SIZE),
+        AssetManager::ManifestEntry::TextFont("lander_bold", FONT_LANDER_BOLD, UI_MAIN_MENU_FONT_SIZE),
+    };
 
 protected:
     void SetupMenuEntities();
     SystemManager systemManager;
-    static constexpr i32 SCENE_NAME = ToSceneId(SceneName::SceneMainMenu);
 };
 
 #endif //SCENEMAINMENU_H
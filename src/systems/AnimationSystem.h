@@ -0,0 +1,120 @@
+#ifndef ANIMATIONSYSTEM_H
+#define ANIMATIONSYSTEM_H
+
+#include <entt/entt.hpp>
+#include <algorithm>
+#include <vector>
+
+#include "Animation.h"
+#include "AssetManager.h"
+#include "components/DrawingComponent.h"
+
+// Scratch clocks for the batched frame advance
+struct AnimationState {
+    std::vector<entt::entity> entities;
+    std::vector<float> elapsed, frameDuration;
+    std::vector<i32> frame, frameCount;
+    std::vector<u8> loop, changed;
+
+    void Clear() {
+        entities.clear();
+        elapsed.clear();
+        frameDuration.clear();
+        frame.clear();
+        frameCount.clear();
+        loop.clear();
+    }
+
+    void Push(entt::entity entity, const AnimatedSpriteComponent& animation) {
+        entities.push_back(entity);
+        elapsed.push_back(animation.elapsed);
+        frameDuration.push_back(animation.frameDuration);
+        frame.push_back(animation.frame);
+        frameCount.push_back(static_cast<i32>(animation.frameCount));
+        loop.push_back(animation.loop);
+    }
+};
+
+// Advances every AnimatedSpriteComponent in one pass over SoA clocks, then points each
+// SpriteComponent at its current frame. Sprites are only patched when their frame changes,
+// so cached render layers don't redraw for animations that are holding a frame. Frames and
+// textures come from one AssetManager snapshot pinned for the whole pass.
+class AnimationSystem {
+public:
+    static void Update(entt::registry& registry, float deltaTime) {
+        auto& state = registry.ctx().emplace<AnimationState>();
+        state.Clear();
+
+        AssetManager::ReadScope read;
+        auto view = registry.view<AnimatedSpriteComponent, SpriteComponent>();
+        for (auto entity : view) {
+            auto& animation = view.get<AnimatedSpriteComponent>(entity);
+            if (animation.generation == 0 && !Resolve(read, registry, entity, animation)) continue;
+            if (animation.frameDuration <= 0.0f) continue;  // Paused
+            state.Push(entity, animation);
+        }
+        if (state.entities.empty()) return;
+
+        state.changed.resize(state.entities.size());
+        animation::AdvanceFrames(state.elapsed.data(), state.frameDuration.data(), state.frame.data(),
+                                 state.frameCount.data(), state.loop.data(), state.entities.size(),
+                                 deltaTime, state.changed.data());
+
+        // Many entities share an animation, so the lookup rarely repeats
+        AssetId textureId;
+        const AssetManager::TextureView* texture = nullptr;
+        for (size_t i = 0; i < state.entities.size(); ++i) {
+            auto& animation = view.get<AnimatedSpriteComponent>(state.entities[i]);
+            animation.elapsed = state.elapsed[i];
+            animation.frame = state.frame[i];
+            if (!state.changed[i]) continue;
+
+            if (texture == nullptr || animation.animation != textureId) {
+                textureId = animation.animation;
+                texture = read.FindTexture(textureId);
+            }
+            if (texture == nullptr || texture->generation != animation.generation ||
+                static_cast<size_t>(animation.frame) >= texture->framePositions.size()) {
+                // Texture was replaced or unloaded since it was resolved, resolve again next frame
+                animation.generation = 0;
+                continue;
+            }
+            registry.patch<SpriteComponent>(state.entities[i], [&](SpriteComponent& sprite) {
+                sprite.source = texture->framePositions[animation.frame];
+            });
+        }
+    }
+
+    // Switches an entity to another animation, starting from its first frame
+    static void Play(entt::registry& registry, entt::entity entity, AssetId animation, float frameDuration, bool loop = true) {
+        registry.patch<AnimatedSpriteComponent>(entity, [&](AnimatedSpriteComponent& component) {
+            component.animation = animation;
+            component.frameDuration = frameDuration;
+            component.loop = loop;
+            component.frame = 0;
+            component.elapsed = 0.0f;
+            component.generation = 0;
+        });
+    }
+
+private:
+    // Looks the animation up once; stays unresolved (and skipped) while the texture is still loading
+    static bool Resolve(const AssetManager::ReadScope& read, entt::registry& registry, entt::entity entity,
+                        AnimatedSpriteComponent& animation) {
+        const AssetManager::TextureView* texture = read.FindTexture(animation.animation);
+        if (texture == nullptr || texture->type != AssetManager::TextureType::Animated || texture->framePositions.empty()) {
+            return false;
+        }
+
+        animation.generation = texture->generation;
+        animation.frameCount = static_cast<u32>(texture->framePositions.size());
+        animation.frame = std::clamp(animation.frame, 0, static_cast<i32>(animation.frameCount) - 1);
+        registry.patch<SpriteComponent>(entity, [&](SpriteComponent& sprite) {
+            sprite.texture = read.FindTextureHandle(animation.animation);
+            sprite.source = texture->framePositions[animation.frame];
+        });
+        return true;
+    }
+};
+
+#endif //ANIMATIONSYSTEM_H
@@ -0,0 +1,109 @@
+#ifndef BULLETPOOL_H
+#define BULLETPOOL_H
+
+#include <cmath>
+#include <vector>
+
+#include "AssetManager.h"
+#include "Projectiles.h"
+#include "components/PlayerComponent.h"
+#include "GameConfig.h"
+#include "raylib.h"
+
+// Every live bullet of a scene, structure-of-arrays. Bullets aren't entities: BulletSystem moves
+// and culls them in one pass over the arrays, and CollisionSystem, DamageSystem and RenderSystem
+// read the arrays directly and skip dead slots. Slots stay put from one BulletSystem update to
+// the next, dead bullets are dropped in batches.
+struct BulletPool {
+    static constexpr u32 NO_SLOT = ~0u;
+    // Dead bullets are only dropped once they fill 1/COMPACT_DIVISOR of the slots, so the
+    // gather over every array is paid every few frames instead of each one
+    static constexpr size_t COMPACT_DIVISOR = 4;
+
+    std::vector<float> x, y;            // Centre
+    std::vector<float> vx, vy;          // Pixels per 1/60 s
+    std::vector<float> width, height, rotation;
+    std::vector<u8> damage;
+    std::vector<BulletType> type;
+    std::vector<u8> alive;
+
+    size_t liveCount = 0;               // Slots with `alive` set
+    std::vector<u32> indices;           // Compaction scratch
+    float step = 0.0f;                  // Of the last Update, a bullet last moved by its velocity times this
+
+    // Shared by every bullet, resolved after the scene atlas is built
+    AssetManager::TextureHandle texture;
+    Rectangle source{0.0f, 0.0f, 0.0f, 0.0f};
+
+    size_t Size() const { return x.size(); }
+
+    void Spawn(Vector2 position, float angle, u8 speed, u8 size, u8 bulletDamage, BulletType bulletType) {
+        // Direction never changes, so sin/cos are paid once here instead of every frame
+        const float radians = angle * DEG2RAD;
+        x.push_back(position.x);
+        y.push_back(position.y);
+        vx.push_back(std::sin(radians) * static_cast<float>(speed));
+        vy.push_back(-std::cos(radians) * static_cast<float>(speed));
+        width.push_back(BULLET_BASE_WIDTH * static_cast<float>(size));
+        height.push_back(BULLET_BASE_HEIGHT * static_cast<float>(size));
+        rotation.push_back(angle);
+        damage.push_back(bulletDamage);
+        type.push_back(bulletType);
+        alive.push_back(1);
+        ++liveCount;
+    }
+
+    // Spent bullets stay in place, invisible and harmless, until a later Update drops them
+    void Kill(u32 slot) {
+        liveCount -= alive[slot];
+        alive[slot] = 0;
+    }
+
+    // Moves every bullet by `deltaFactor` ticks and kills those outside `bounds`
+    void Update(float deltaFactor, const Rectangle& bounds) {
+        step = deltaFactor;
+        const size_t count = Size();
+        if (count == 0) return;
+
+        const size_t aliveCount = projectiles::Integrate(x.data(), y.data(), vx.data(), vy.data(), alive.data(),
+                                                         count, step, bounds);
+        liveCount = aliveCount;
+        if ((count - aliveCount) * COMPACT_DIVISOR < count) return;
+
+        indices.resize(count);
+        projectiles::CompactIndices(alive.data(), count, indices.data());
+        Compact(x, aliveCount);
+        Compact(y, aliveCount);
+        Compact(vx, aliveCount);
+        Compact(vy, aliveCount);
+        Compact(width, aliveCount);
+        Compact(height, aliveCount);
+        Compact(rotation, aliveCount);
+        Compact(damage, aliveCount);
+        Compact(type, aliveCount);
+        alive.assign(aliveCount, 1);
+    }
+
+    void Clear() {
+        x.clear();
+        y.clear();
+        vx.clear();
+        vy.clear();
+        width.clear();
+        height.clear();
+        rotation.clear();
+        damage.clear();
+        type.clear();
+        alive.clear();
+        liveCount = 0;
+    }
+
+private:
+    template<typename T>
+    void Compact(std::vector<T>& data, size_t aliveCount) {
+        projectiles::Gather(data.data(), indices.data(), aliveCount);
+        data.resize(aliveCount);
+    }
+};
+
+#endif //BULLETPOOL_H
@@ -1,4 +0,0 @@
-#include "BulletSystem.h"
-
-// Define the static member
-const Texture* BulletSystem::bulletTexture = nullptr; 
\ No newline at end of file
@@ -2,110 +2,237 @@
 #define COLLISIONSYSTEM_H
 
 #include <entt/entt.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#include "Overlap.h"
+#include "Parallel.h"
+#include "SpatialGrid.h"
+#include "BulletPool.h"
 #include "components/BasicComponent.h"
-#include "components/PlayerComponent.h"
+#include "components/ColliderComponent.h"
 #include "components/DrawingComponent.h"
 #include "GameConfig.h"
 
+// Pooled bullets have no entity, they are named by their BulletPool slot instead
+struct CollisionEvent {
+    entt::entity first;         // The collider whose mask asked for the hit
+    entt::entity second;
+    u32 firstSlot;              // BulletPool slot, or BulletPool::NO_SLOT for entities
+    u32 secondSlot;
+    CollisionLayer firstLayer;
+    CollisionLayer secondLayer;
+    float time;                 // When in the frame the two met, 0 = start, 1 = end
+};
+
+// Hits found by the last collision pass, ordered by time of impact. Response systems (damage, score,
+// effects) read them in bulk after CollisionSystem; nothing here changes the registry.
+struct CollisionEvents {
+    std::vector<CollisionEvent> events;
+};
+
+// Every collider on one layer, packed for the overlap tests
+struct CollisionLayerSet {
+    CollisionLayerSet() {
+        grid.Reset(Rectangle{0.0f, 0.0f, VIRTUAL_WIDTH, VIRTUAL_HEIGHT}, COLLISION_GRID_CELL_SIZE);
+    }
+
+    std::vector<entt::entity> entities;     // Null for pooled bullets
+    std::vector<u32> slots;                 // BulletPool slot, NO_SLOT for entities
+    std::vector<u32> masks;
+    std::vector<collision::Aabb> boxes;     // At the start of the frame
+    std::vector<Vector2> sweeps;
+    collision::AabbSoA bounds;              // Covers the whole sweep, for the broadphase
+    u32 maskUnion = 0;          // Layers any collider here hits
+
+    SpatialGrid grid;           // Built on demand when the layer is a large target
+    bool gridBuilt = false;
+
+    size_t Size() const { return entities.size(); }
+
+    // `position` is the box's top-left at the end of the frame, after moving by `sweep`
+    void Push(entt::entity entity, u32 slot, u32 mask, Vector2 position, Vector2 size, Vector2 sweep) {
+        const float startX = position.x - sweep.x;
+        const float startY = position.y - sweep.y;
+        entities.push_back(entity);
+        slots.push_back(slot);
+        masks.push_back(mask);
+        boxes.push_back(collision::Aabb{startX, startY, startX + size.x, startY + size.y});
+        sweeps.push_back(sweep);
+        bounds.Push(Rectangle{std::min(startX, position.x), std::min(startY, position.y),
+                              size.x + std::abs(sweep.x), size.y + std::abs(sweep.y)});
+        maskUnion |= mask;
+    }
+
+    void Clear() {
+        entities.clear();
+        slots.clear();
+        masks.clear();
+        boxes.clear();
+        sweeps.clear();
+        bounds.Clear();
+        maskUnion = 0;
+        gridBuilt = false;
+    }
+};
+
+// Scratch for one collision pass
+struct CollisionState {
+    std::array<CollisionLayerSet, static_cast<size_t>(CollisionLayer::Count)> layers;
+    std::vector<collision::HitPair> pairs;
+
+    // Grid queries run in chunks on the workers and are merged back in query order
+    std::mutex chunkMutex;
+    std::vector<std::pair<size_t, std::vector<CollisionEvent>>> chunks;
+};
+
+// Detection only: finds every pair of colliders whose layers and masks match and that meet
+// during the frame, testing swept boxes so fast bullets can't tunnel through small enemies,
+// and writes them to CollisionEvents. Each layer pair is tested on its own; a small target layer
+// (the players) is tested against all its hitters with the batched overlap kernel, a large one
+// (the enemies) goes into a grid that the hitters query in parallel.
 class CollisionSystem {
 public:
+    static constexpr size_t MIN_QUERIES_PER_TASK = 256;
+    static constexpr size_t MAX_BATCHED_TARGETS = 16;
+
     static void Update(entt::registry& registry, float deltaTime) {
-        // Get all bullets, enemies, and player
-        auto bulletView = registry.view<TransformComponent, BulletComponent, SpriteComponent>();
-        auto enemyView = registry.view<TransformComponent, EnemyComponent, SpriteComponent>();
-        auto playerView = registry.view<TransformComponent, PlayerComponent, SpriteComponent>();
-
-        // Pre-calculate player rectangle if player exists
-        Rectangle playerRect = {0};
-        bool playerExists = false;
-        for (auto playerEntity : playerView) {
-            const auto& playerTransform = playerView.get<TransformComponent>(playerEntity);
-            const auto& playerSprite = playerView.get<SpriteComponent>(playerEntity);
-            
-            playerRect = {
-                playerTransform.position.x - playerSprite.size.x / 2.0f,
-                playerTransform.position.y - playerSprite.size.y / 2.0f,
-                playerSprite.size.x,
-                playerSprite.size.y
-            };
-            playerExists = true;
-            break;
+        auto& state = registry.ctx().emplace<CollisionState>();
+        auto& events = registry.ctx().emplace<CollisionEvents>().events;
+        events.clear();
+        for (auto& set : state.layers) set.Clear();
+
+        auto colliderView = registry.view<TransformComponent, ColliderComponent>();
+        for (auto entity : colliderView) {
+            const auto& transform = colliderView.get<TransformComponent>(entity);
+            const auto& collider = colliderView.get<ColliderComponent>(entity);
+
+            Vector2 size = collider.size;
+            if (size.x == 0.0f && size.y == 0.0f) {
+                if (const auto* sprite = registry.try_get<SpriteComponent>(entity)) size = sprite->size;
+            }
+
+            state.layers[static_cast<size_t>(collider.layer)].Push(entity, BulletPool::NO_SLOT, collider.mask,
+                Vector2{transform.position.x - size.x / 2.0f, transform.position.y - size.y / 2.0f}, size, collider.sweep);
         }
 
-        // Check each bullet against appropriate targets
-        for (auto bulletEntity : bulletView) {
-            const auto& bulletTransform = bulletView.get<TransformComponent>(bulletEntity);
-            const auto& bulletComp = bulletView.get<BulletComponent>(bulletEntity);
-            const auto& bulletSprite = bulletView.get<SpriteComponent>(bulletEntity);
-
-            // Create bullet AABB once
-            const Rectangle bulletRect = {
-                bulletTransform.position.x - bulletSprite.size.x / 2.0f,
-                bulletTransform.position.y - bulletSprite.size.y / 2.0f,
-                bulletSprite.size.x,
-                bulletSprite.size.y
-            };
-
-            if (bulletComp.type == BulletType::Player) {
-                // Player bullets check against enemies
-                for (auto enemyEntity : enemyView) {
-                    const auto& enemyTransform = enemyView.get<TransformComponent>(enemyEntity);
-                    auto& enemyComp = enemyView.get<EnemyComponent>(enemyEntity);
-                    const auto& enemySprite = enemyView.get<SpriteComponent>(enemyEntity);
-
-                    // Create enemy AABB
-                    const Rectangle enemyRect = {
-                        enemyTransform.position.x - enemySprite.size.x / 2.0f,
-                        enemyTransform.position.y - enemySprite.size.y / 2.0f,
-                        enemySprite.size.x,
-                        enemySprite.size.y
-                    };
-
-                    // Check for collision
-                    if (CheckCollisionRecs(bulletRect, enemyRect)) {
-                        // Apply damage to enemy
-                        enemyComp.health -= bulletComp.bulletDamage;
-
-                        // Remove bullet
-                        registry.destroy(bulletEntity);
-
-                        // Remove enemy if health is depleted
-                        if (enemyComp.health <= 0) {
-                            registry.destroy(enemyEntity);
-                        }
-
-                        // Break out of enemy loop since bullet is destroyed
-                        break;
-                    }
-                }
-            } else if (playerExists) {
-                // Enemy bullets check against player
-                if (CheckCollisionRecs(bulletRect, playerRect)) {
-                    auto& playerComp = playerView.get<PlayerComponent>(playerView.front());
-                    
-                    // Remove a life from player
-                    playerComp.lives--;
-
-                    // Remove bullet
-                    registry.destroy(bulletEntity);
-
-                    // Remove player if no lives left
-                    if (playerComp.lives <= 0) {
-                        registry.destroy(playerView.front());
-                        // TODO: Handle game over
-                    }
+        if (const auto* pool = registry.ctx().find<BulletPool>()) {
+            GatherBullets(*pool, state);
+        }
+
+        for (size_t hitter = 0; hitter < state.layers.size(); ++hitter) {
+            const auto& hitters = state.layers[hitter];
+            if (hitters.Size() == 0) continue;
+
+            for (size_t target = 0; target < state.layers.size(); ++target) {
+                // Layer pairs no collider asks for are rejected here, before any bounds are touched
+                if ((hitters.maskUnion & LayerBit(static_cast<CollisionLayer>(target))) == 0) continue;
+                if (state.layers[target].Size() == 0) continue;
+
+                if (state.layers[target].Size() <= MAX_BATCHED_TARGETS) {
+                    TestBatched(state, hitter, target, events);
+                } else {
+                    TestGrid(state, hitter, target, events);
                 }
             }
         }
+
+        // Responses see hits in the order they happened, so a bullet hits the nearest enemy on its path
+        std::ranges::stable_sort(events, {}, &CollisionEvent::time);
     }
 
 private:
-    static bool CheckCollisionRecs(const Rectangle& rec1, const Rectangle& rec2) {
-        return (rec1.x < rec2.x + rec2.width &&
-                rec1.x + rec1.width > rec2.x &&
-                rec1.y < rec2.y + rec2.height &&
-                rec1.y + rec1.height > rec2.y);
+    // Player bullets only hit enemies, enemy bullets only the player
+    static void GatherBullets(const BulletPool& pool, CollisionState& state) {
+        auto& playerBullets = state.layers[static_cast<size_t>(CollisionLayer::PlayerBullet)];
+        auto& enemyBullets = state.layers[static_cast<size_t>(CollisionLayer::EnemyBullet)];
+        for (size_t i = 0; i < pool.Size(); ++i) {
+            if (!pool.alive[i]) continue;
+            const bool player = pool.type[i] == BulletType::Player;
+            const Vector2 size{pool.width[i], pool.height[i]};
+            (player ? playerBullets : enemyBullets).Push(entt::null, static_cast<u32>(i),
+                LayerBit(player ? CollisionLayer::Enemy : CollisionLayer::Player),
+                Vector2{pool.x[i] - size.x / 2.0f, pool.y[i] - size.y / 2.0f}, size,
+                Vector2{pool.vx[i] * pool.step, pool.vy[i] * pool.step});
+        }
+    }
+
+    // Whether hitter `i` reports its overlap with target `j`. When both sides ask for the hit,
+    // only the lower layer (or, within one layer, the lower index) reports it.
+    static bool Reports(const CollisionState& state, size_t hitter, u32 i, size_t target, u32 j) {
+        const auto& hitters = state.layers[hitter];
+        const auto& targets = state.layers[target];
+        if ((hitters.masks[i] & LayerBit(static_cast<CollisionLayer>(target))) == 0) return false;
+        if (hitter == target && i == j) return false;
+
+        const bool targetReports = (targets.masks[j] & LayerBit(static_cast<CollisionLayer>(hitter))) != 0;
+        return !targetReports || hitter < target || (hitter == target && i < j);
+    }
+
+    // Exact test of two candidates, in the target's frame of reference
+    static bool Sweep(const CollisionState& state, size_t hitter, u32 i, size_t target, u32 j, float& time) {
+        const auto& hitters = state.layers[hitter];
+        const auto& targets = state.layers[target];
+        const Vector2 delta{hitters.sweeps[i].x - targets.sweeps[j].x, hitters.sweeps[i].y - targets.sweeps[j].y};
+        return collision::SweepAabb(hitters.boxes[i], delta, targets.boxes[j], time);
+    }
+
+    static CollisionEvent MakeEvent(const CollisionState& state, size_t hitter, u32 i, size_t target, u32 j, float time) {
+        const auto& hitters = state.layers[hitter];
+        const auto& targets = state.layers[target];
+        return {hitters.entities[i], targets.entities[j], hitters.slots[i], targets.slots[j],
+                static_cast<CollisionLayer>(hitter), static_cast<CollisionLayer>(target), time};
+    }
+
+    // Few targets: each target's swept bounds against every hitter's, SIMD over the hitters
+    static void TestBatched(CollisionState& state, size_t hitter, size_t target, std::vector<CollisionEvent>& events) {
+        state.pairs.clear();
+        collision::OverlapPairs(state.layers[target].bounds, state.layers[hitter].bounds, state.pairs);
+        for (const auto& pair : state.pairs) {
+            float time = 0.0f;
+            if (Reports(state, hitter, pair.target, target, pair.query) && Sweep(state, hitter, pair.target, target, pair.query, time)) {
+                events.push_back(MakeEvent(state, hitter, pair.target, target, pair.query, time));
+            }
+        }
+    }
+
+    // Many targets: bucket them in a grid, each hitter queries only the cells it touches
+    static void TestGrid(CollisionState& state, size_t hitter, size_t target, std::vector<CollisionEvent>& events) {
+        auto& targets = state.layers[target];
+        if (!targets.gridBuilt) {
+            const auto& bounds = targets.bounds;
+            targets.grid.Build(bounds.minX.data(), bounds.minY.data(), bounds.maxX.data(), bounds.maxY.data(), bounds.Size());
+            targets.gridBuilt = true;
+        }
+
+        const auto& hitters = state.layers[hitter];
+        state.chunks.clear();
+        parallel::For(hitters.Size(), MIN_QUERIES_PER_TASK, [&](size_t begin, size_t end) {
+            std::vector<CollisionEvent> found;
+            for (size_t i = begin; i < end; ++i) {
+                const auto& bounds = hitters.bounds;
+                const Rectangle box{bounds.minX[i], bounds.minY[i], bounds.maxX[i] - bounds.minX[i], bounds.maxY[i] - bounds.minY[i]};
+                targets.grid.Query(box, [&](u32 j) {
+                    float time = 0.0f;
+                    if (Reports(state, hitter, static_cast<u32>(i), target, j) && Sweep(state, hitter, static_cast<u32>(i), target, j, time)) {
+                        found.push_back(MakeEvent(state, hitter, static_cast<u32>(i), target, j, time));
+                    }
+                    return true;
+                });
+            }
+            if (found.empty()) return;
+            std::lock_guard lock(state.chunkMutex);
+            state.chunks.emplace_back(begin, std::move(found));
+        });
+
+        std::ranges::sort(state.chunks, {}, &std::pair<size_t, std::vector<CollisionEvent>>::first);
+        for (const auto& [begin, found] : state.chunks) {
+            events.insert(events.end(), found.begin(), found.end());
+        }
     }
 };
 
-#endif //COLLISIONSYSTEM_H 
\ No newline at end of file
+#endif //COLLISIONSYSTEM_H
@@ -0,0 +1,142 @@
+#ifndef COMMANDBUFFER_H
+#define COMMANDBUFFER_H
+
+#include <entt/entt.hpp>
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "Defines.h"
+
+// Structural changes (destroy, emplace, remove) recorded while systems iterate views and
+// applied in one batch when the scene publishes its frame, so no storage is reshuffled under a
+// running view. Lives in the registry context of scenes that use it.
+//
+// Recording is thread-safe. Systems on worker threads should record through a Recorder, which
+// buffers locally and takes the lock once when it goes out of scope.
+class CommandBuffer {
+public:
+    class Recorder;
+
+    void Destroy(entt::entity entity) {
+        std::lock_guard lock(mutex);
+        destroys.push_back(entity);
+    }
+
+    // Emplaces or replaces T once the buffer is applied
+    template<typename T, typename... Args>
+    void Emplace(entt::entity entity, Args&&... args) {
+        std::lock_guard lock(mutex);
+        RecordEmplace<T>(components, entity, std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void Remove(entt::entity entity) {
+        std::lock_guard lock(mutex);
+        RecordRemove<T>(components, entity);
+    }
+
+    // Runs everything recorded so far. Component commands are grouped by component type, then
+    // by entity, keeping record order within an entity; destroys go last, sorted and deduplicated.
+    // Commands for entities that are destroyed in the same batch, or already gone, are dropped.
+    void Apply(entt::registry& registry) {
+        {
+            std::lock_guard lock(mutex);
+            applyingDestroys.swap(destroys);
+            applyingComponents.swap(components);
+        }
+
+        std::ranges::sort(applyingDestroys, {}, EntityKey);
+        applyingDestroys.erase(std::unique(applyingDestroys.begin(), applyingDestroys.end()), applyingDestroys.end());
+
+        std::ranges::stable_sort(applyingComponents, [](const ComponentCommand& a, const ComponentCommand& b) {
+            return a.type != b.type ? a.type < b.type : EntityKey(a.entity) < EntityKey(b.entity);
+        });
+        for (auto& command : applyingComponents) {
+            if (!registry.valid(command.entity)) continue;
+            if (std::ranges::binary_search(applyingDestroys, EntityKey(command.entity), {}, EntityKey)) continue;
+            command.apply(registry, command.entity);
+        }
+
+        for (const entt::entity entity : applyingDestroys) {
+            if (registry.valid(entity)) registry.destroy(entity);
+        }
+        applyingDestroys.clear();
+        applyingComponents.clear();
+    }
+
+    bool Empty() {
+        std::lock_guard lock(mutex);
+        return destroys.empty() && components.empty();
+    }
+
+private:
+    struct ComponentCommand {
+        entt::id_type type;
+        entt::entity entity;
+        std::function<void(entt::registry&, entt::entity)> apply;
+    };
+
+    // Storage slot first so a batch walks the pools in order, then version so a recycled slot stays distinct
+    static u64 EntityKey(entt::entity entity) {
+        return (static_cast<u64>(entt::to_entity(entity)) << 32) | entt::to_version(entity);
+    }
+
+    template<typename T, typename... Args>
+    static void RecordEmplace(std::vector<ComponentCommand>& out, entt::entity entity, Args&&... args) {
+        out.push_back({entt::type_hash<T>::value(), entity,
+            [component = T{std::forward<Args>(args)...}](entt::registry& registry, entt::entity target) mutable {
+                registry.emplace_or_replace<T>(target, std::move(component));
+            }});
+    }
+
+    template<typename T>
+    static void RecordRemove(std::vector<ComponentCommand>& out, entt::entity entity) {
+        out.push_back({entt::type_hash<T>::value(), entity, [](entt::registry& registry, entt::entity target) {
+            registry.remove<T>(target);
+        }});
+    }
+
+    std::mutex mutex;
+    std::vector<entt::entity> destroys;
+    std::vector<ComponentCommand> components;
+
+    // Kept between batches so their capacity is reused
+    std::vector<entt::entity> applyingDestroys;
+    std::vector<ComponentCommand> applyingComponents;
+};
+
+// Thread-local recording into a CommandBuffer, merged when the recorder is destroyed
+class CommandBuffer::Recorder {
+public:
+    explicit Recorder(CommandBuffer& buffer) : buffer{buffer} {}
+
+    ~Recorder() {
+        if (destroys.empty() && components.empty()) return;
+        std::lock_guard lock(buffer.mutex);
+        buffer.destroys.insert(buffer.destroys.end(), destroys.begin(), destroys.end());
+        buffer.components.insert(buffer.components.end(),
+                                 std::make_move_iterator(components.begin()), std::make_move_iterator(components.end()));
+    }
+
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    void Destroy(entt::entity entity) { destroys.push_back(entity); }
+
+    template<typename T, typename... Args>
+    void Emplace(entt::entity entity, Args&&... args) {
+        RecordEmplace<T>(components, entity, std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void Remove(entt::entity entity) { RecordRemove<T>(components, entity); }
+
+private:
+    CommandBuffer& buffer;
+    std::vector<entt::entity> destroys;
+    std::vector<ComponentCommand> components;
+};
+
+#endif //COMMANDBUFFER_H
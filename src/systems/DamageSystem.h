@@ -0,0 +1,65 @@
+#ifndef DAMAGESYSTEM_H
+#define DAMAGESYSTEM_H
+
+#include <entt/entt.hpp>
+
+#include "BulletPool.h"
+#include "CollisionSystem.h"
+#include "CommandBuffer.h"
+#include "components/PlayerComponent.h"
+
+// Collision response for bullets: a bullet damages the first enemy or player it is reported
+// hitting this pass and is then killed in the BulletPool. Runs after CollisionSystem; entity
+// destroys are deferred.
+class DamageSystem {
+public:
+    static void Update(entt::registry& registry, float deltaTime) {
+        const auto* events = registry.ctx().find<CollisionEvents>();
+        auto* pool = registry.ctx().find<BulletPool>();
+        if (events == nullptr || events->events.empty() || pool == nullptr) return;
+
+        auto& commands = registry.ctx().get<CommandBuffer>();
+        for (const auto& event : events->events) {
+            u32 slot = event.firstSlot;
+            entt::entity targetEntity = event.second;
+            if (slot == BulletPool::NO_SLOT) {
+                slot = event.secondSlot;
+                targetEntity = event.first;
+                if (slot == BulletPool::NO_SLOT) continue;
+            }
+            // Spent on an earlier hit this pass
+            if (!pool->alive[slot]) continue;
+
+            if (auto* enemy = registry.try_get<EnemyComponent>(targetEntity)) {
+                // Already killed by an earlier bullet this pass
+                if (enemy->health <= 0) continue;
+
+                // Apply damage to enemy
+                enemy->health -= pool->damage[slot];
+
+                // Remove enemy if health is depleted
+                if (enemy->health <= 0) {
+                    commands.Destroy(targetEntity);
+                }
+            } else if (auto* player = registry.try_get<PlayerComponent>(targetEntity)) {
+                if (player->lives <= 0) continue;
+
+                // Remove a life from player
+                player->lives--;
+
+                // Remove player if no lives left
+                if (player->lives <= 0) {
+                    commands.Destroy(targetEntity);
+                    // TODO: Handle game over
+                }
+            } else {
+                continue;
+            }
+
+            // Remove bullet
+            pool->Kill(slot);
+        }
+    }
+};
+
+#endif //DAMAGESYSTEM_H
@@ -6,6 +6,7 @@
 #include "KeyManager.h"
 #include "Game.h"
 #include "scenes/SceneGame.h"
+#include "UiText.h"
 
 class MenuSystem {
 public:
@@ -19,14 +20,16 @@ public:
         if (blinkTimer >= BLINK_INTERVAL) {
             blinkTimer = 0.0f;
             isVisible = !isVisible;
-        }
 
-        // Update text visibility
-        auto view = registry.view<TextComponentPixelPerfect>();
-        for (auto entity : view) {
-            auto& text = view.get<TextComponentPixelPerfect>(entity);
-            if (text.text == "INSERT CREDIT(S)" || text.text == "OR PRESS ENTER") {
-                text.tint.a = isVisible ? 255 : 0;
+            // Update text visibility, patching so the cached HUD layer redraws
+            auto view = registry.view<TextComponentPixelPerfect>();
+            for (auto entity : view) {
+                const auto& text = view.get<TextComponentPixelPerfect>(entity);
+                if (text.text == UI_TEXT_INSERT_CREDIT || text.text == UI_TEXT_PRESS_ENTER) {
+                    registry.patch<TextComponentPixelPerfect>(entity, [](auto& blinking) {
+                        blinking.tint.a = isVisible ? 255 : 0;
+                    });
+                }
             }
         }
 
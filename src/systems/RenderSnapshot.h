@@ -0,0 +1,104 @@
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include "FrameMailbox.h"
+#include "TextLayout.h"
+#include "components/DrawingComponent.h"
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Everything the renderer needs for one frame, copied out of the registry so
+// drawing never reads components the simulation may be writing
+struct RenderSnapshot {
+    struct RectItem {
+        Rectangle rectangle;
+        float rotation;
+        Color color;
+    };
+
+    struct SpriteItem {
+        Texture2D texture;
+        Rectangle source;
+        Rectangle dest;
+        Vector2 origin;
+        float rotation;
+        Color tint;
+    };
+
+    struct TextItem {
+        std::string text;
+        int x, y;
+        int fontSize;
+        Color color;
+    };
+
+    struct LayoutTextItem {
+        Font font;
+        std::shared_ptr<const render::TextLayout> layout;
+        Vector2 position;
+        float rotation;
+        Color tint;
+    };
+
+    struct TileChunkItem {
+        Texture2D texture;
+        std::shared_ptr<const std::vector<render::TexturedQuad>> quads;
+        Vector2 position;
+        Color tint;
+    };
+
+    // Draw lists of one layer, in submission order
+    struct LayerItems {
+        std::vector<TileChunkItem> tileChunks;
+        std::vector<RectItem> rectangles;
+        std::vector<SpriteItem> sprites;
+        std::vector<TextItem> texts;
+        std::vector<LayoutTextItem> layoutTexts;
+        bool incomplete = false;    // Some texture was evicted and is still reloading
+
+        void Clear() {
+            tileChunks.clear();
+            rectangles.clear();
+            sprites.clear();
+            texts.clear();
+            layoutTexts.clear();
+            incomplete = false;
+        }
+
+        bool Empty() const {
+            return tileChunks.empty() && rectangles.empty() && sprites.empty() && texts.empty() && layoutTexts.empty();
+        }
+    };
+
+    static constexpr size_t LAYER_COUNT = static_cast<size_t>(RenderLayer::Count);
+
+    bool hasCamera = false;
+    Camera2D worldCamera{};
+    Camera2D screenCamera{};
+    RenderTexture2D target{};
+    Rectangle sourceRec{};
+
+    LayerItems dynamic;
+
+    // Cached layers are shared between snapshots and only rebuilt when their version moves
+    std::array<std::shared_ptr<const LayerItems>, LAYER_COUNT> cachedLayers;
+    std::array<u64, LAYER_COUNT> layerVersions{};
+
+    u32 submitted = 0;
+    u32 culled = 0;
+};
+
+// Render side of a registry: the snapshot hand-off and the GPU targets of the cached layers
+struct RenderFrameState {
+    struct LayerTarget {
+        RenderTexture2D target{};
+        u64 renderedVersion = 0;
+    };
+
+    FrameMailbox<RenderSnapshot> mailbox;
+    std::array<LayerTarget, RenderSnapshot::LAYER_COUNT> layers;
+};
+
+#endif //RENDERSNAPSHOT_H
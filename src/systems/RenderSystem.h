@@ -5,31 +5,158 @@
 #ifndef RENDERSYSTEM_H
 #define RENDERSYSTEM_H
 #include "Renderer.h"
+#include "Culling.h"
+#include "SpatialGrid.h"
+#include "TextLayout.h"
+#include "RenderTargetPool.h"
+#include "RenderSnapshot.h"
+#include "TilemapSystem.h"
+#include "BulletPool.h"
 #include "components/BasicComponent.h"
 #include "components/DrawingComponent.h"
 #include "GameConfig.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
+// Simulation side of the cached render layers: bumped versions mark a layer for redraw
+struct RenderLayerCache {
+    struct Layer {
+        u64 version = 1;
+        u64 contentVersion = 1;     // Like version, but camera moves leave it alone
+        u64 extractedVersion = 0;
+        std::shared_ptr<const RenderSnapshot::LayerItems> items;  // Null when nothing is on the layer
+    };
+
+    std::array<Layer, static_cast<size_t>(RenderLayer::Count)> layers;
+    Camera2D camera{};
+};
+
+// Bounds of one component type on one cached layer, kept with a grid over them. A camera move
+// re-extracts every cached layer without changing what is on it, so the grid answers the new
+// view bounds without gathering and sweeping the layer again.
+struct RenderCullIndex {
+    u64 contentVersion = 0;
+    std::vector<entt::entity> entities;
+    std::vector<float> minX, minY, maxX, maxY;
+    SpatialGrid grid;
+};
+
+// Scratch bounds for the culling stage
+struct RenderCullState {
+    std::vector<entt::entity> entities;
+    std::vector<float> minX, minY, maxX, maxY;
+    std::vector<u8> visible;
+    std::vector<u32> candidates;
+
+    // Keyed by layer and component type, see IndexKey
+    std::unordered_map<u64, RenderCullIndex> indices;
+
+    void Clear() {
+        entities.clear();
+        minX.clear();
+        minY.clear();
+        maxX.clear();
+        maxY.clear();
+    }
+
+    void Push(entt::entity entity, const Rectangle& bounds) {
+        entities.push_back(entity);
+        minX.push_back(bounds.x);
+        minY.push_back(bounds.y);
+        maxX.push_back(bounds.x + bounds.width);
+        maxY.push_back(bounds.y + bounds.height);
+    }
+};
+
+// Rendering runs in two halves: Publish copies the visible scene into a snapshot after the
+// update, DrawPixelPerfect draws the newest snapshot. With pipelined rendering the two run
+// on different threads, so DrawPixelPerfect must only ever read the RenderFrameState.
 class RenderSystem {
 public:
+    // Below this many entries a cached layer's sweep is cheaper than keeping a grid for it
+    static constexpr size_t MIN_INDEXED_BOUNDS = 256;
+
+    // Hooks component signals so cached layers know when to redraw
+    static void Initialize(entt::registry& registry) {
+        if (registry.ctx().contains<RenderLayerCache>()) return;
+        registry.ctx().emplace<RenderLayerCache>();
+        registry.ctx().emplace<RenderCullState>();
+        registry.ctx().emplace<RenderFrameState>();
+
+        ConnectLayerSignals<TransformComponent>(registry);
+        ConnectLayerSignals<SpriteComponent>(registry);
+        ConnectLayerSignals<RectangleComponent>(registry);
+        ConnectLayerSignals<TextComponent>(registry);
+        ConnectLayerSignals<TextComponentPro>(registry);
+        ConnectLayerSignals<TextComponentPixelPerfect>(registry);
+        ConnectLayerSignals<TilemapComponent>(registry);
+        ConnectLayerSignals<RenderLayerComponent>(registry);
+    }
+
+    static void Shutdown(entt::registry& registry) {
+        if (!registry.ctx().contains<RenderLayerCache>()) return;
+
+        DisconnectLayerSignals<TransformComponent>(registry);
+        DisconnectLayerSignals<SpriteComponent>(registry);
+        DisconnectLayerSignals<RectangleComponent>(registry);
+        DisconnectLayerSignals<TextComponent>(registry);
+        DisconnectLayerSignals<TextComponentPro>(registry);
+        DisconnectLayerSignals<TextComponentPixelPerfect>(registry);
+        DisconnectLayerSignals<TilemapComponent>(registry);
+        DisconnectLayerSignals<RenderLayerComponent>(registry);
+
+        // Render targets go back to the pool for the next scene
+        for (auto& layer : registry.ctx().get<RenderFrameState>().layers) {
+            render::ReleaseRenderTarget(layer.target);
+        }
+        auto cameras = registry.view<PixelPerfectCameraComponent>();
+        for (auto entity : cameras) {
+            cameras.get<PixelPerfectCameraComponent>(entity).OnDestroy();
+        }
+        registry.ctx().erase<RenderLayerCache>();
+        registry.ctx().erase<RenderCullState>();
+        registry.ctx().erase<RenderFrameState>();
+    }
+
+    // Forces a cached layer to redraw, for changes the component signals can't see
+    static void InvalidateLayer(entt::registry& registry, RenderLayer layer) {
+        if (auto* cache = registry.ctx().find<RenderLayerCache>()) {
+            ++cache->layers[static_cast<size_t>(layer)].version;
+            ++cache->layers[static_cast<size_t>(layer)].contentVersion;
+        }
+    }
+
+    // Copies this frame's draw lists into the next snapshot and hands it to the renderer
+    static void Publish(entt::registry& registry) {
+        Initialize(registry);
+        auto& frames = registry.ctx().get<RenderFrameState>();
+        Extract(registry, frames.mailbox.BeginWrite());
+        frames.mailbox.Publish();
+    }
+
     static void DrawPixelPerfect(entt::registry& registry) {
-        const auto view = registry.view<PixelPerfectCameraComponent>();
-        if (view.empty()) return;  // Early exit if no camera
+        auto* frames = registry.ctx().find<RenderFrameState>();
+        if (frames == nullptr) return;
+
+        const RenderSnapshot* snapshot = frames->mailbox.AcquireLatest();
+        if (snapshot == nullptr || !snapshot->hasCamera) return;  // Early exit if no camera
 
-        auto& camera = view.get<PixelPerfectCameraComponent>(view.front());
-        
         // Cache screen dimensions
         const int screenWidth = GetScreenWidth();
         const int screenHeight = GetScreenHeight();
-        
+
         // Calculate aspect ratios once
         static constexpr float virtualAspect = static_cast<float>(VIRTUAL_WIDTH) / static_cast<float>(VIRTUAL_HEIGHT);
         const float screenAspect = static_cast<float>(screenWidth) / static_cast<float>(screenHeight);
-        
+
         // Calculate viewport dimensions to maintain aspect ratio
         int viewportWidth, viewportHeight;
         int offsetX = 0, offsetY = 0;
-        
+
         if (screenAspect > virtualAspect) {
             // Screen is wider than virtual resolution
             viewportHeight = screenHeight;
@@ -41,145 +168,486 @@ public:
             viewportHeight = static_cast<int>(viewportWidth / virtualAspect);
             offsetY = (screenHeight - viewportHeight) / 2;
         }
-        
-        // Update camera destination rectangle to maintain aspect ratio
-        camera.destRec = {
+
+        // Destination rectangle that maintains the aspect ratio
+        const Rectangle destRec = {
             static_cast<float>(offsetX),
             static_cast<float>(offsetY),
             static_cast<float>(viewportWidth),
             static_cast<float>(viewportHeight)
         };
-        
+
+        // Redraw stale cached layers before the main target is bound
+        RefreshLayer(*frames, *snapshot, RenderLayer::Background);
+        RefreshLayer(*frames, *snapshot, RenderLayer::Hud);
+
         // Begin rendering to the render texture
-        BeginTextureMode(camera.target);
+        render::BeginTextureMode(snapshot->target);
         {
             ClearBackground(RAYWHITE);
-            
-            // Draw the game world using the world space camera
-            BeginMode2D(camera.worldSpaceCamera);
-            {
-                // Draw all rectangles in a single batch
-                auto rectView = registry.view<TransformComponent, RectangleComponent>();
-                for (auto rectEntity : rectView) {
-                    const auto& transform = rectView.get<TransformComponent>(rectEntity);
-                    const auto& rect = rectView.get<RectangleComponent>(rectEntity);
-                    
-                    render::DrawRectanglePro(
-                        rect.rectangle,
-                        { 0.0f, 0.0f },  // origin
-                        transform.rotation,
-                        rect.color
-                    );
-                }
 
-                // Draw all sprites in a single batch
-                auto spriteView = registry.view<TransformComponent, SpriteComponent>();
-                for (auto spriteEntity : spriteView) {
-                    const auto& transform = spriteView.get<TransformComponent>(spriteEntity);
-                    const auto& sprite = spriteView.get<SpriteComponent>(spriteEntity);
-
-                    if (sprite.texture != nullptr) {  // Check if texture pointer is valid
-                        // Create source rectangle using the entire texture
-                        static const Rectangle srcRec = {
-                            0.0f, 0.0f,
-                            static_cast<float>(sprite.texture->width),
-                            static_cast<float>(sprite.texture->height)
-                        };
-
-                        // Create destination rectangle with fixed size
-                        const Rectangle destRec = {
-                            transform.position.x,  // Position at transform point
-                            transform.position.y,  // Position at transform point
-                            sprite.size.x,
-                            sprite.size.y
-                        };
-
-                        render::DrawTexturePro(*sprite.texture,  // Dereference the pointer here
-                            srcRec,
-                            destRec,
-                            Vector2{sprite.size.x / 2, sprite.size.y / 2},  // Set origin to center of sprite
-                            transform.rotation,
-                            sprite.tint);
-                    }
-                }
+            CompositeLayer(*frames, *snapshot, RenderLayer::Background);
 
-                // Draw all text components in a single batch
-                auto textView = registry.view<TransformComponent, TextComponent>();
-                for (auto textEntity : textView) {
-                    const auto& transform = textView.get<TransformComponent>(textEntity);
-                    const auto& text = textView.get<TextComponent>(textEntity);
-
-                    // Draw the text with rotation
-                    render::DrawText(str(text.text).c_str(),
-                        static_cast<int>(transform.position.x), 
-                        static_cast<int>(transform.position.y), 
-                        text.fontSize, 
-                        text.color);
-                }
-
-                // Draw all Pro text components in a single batch
-                auto proTextView = registry.view<TransformComponent, TextComponentPro>();
-                for (auto textEntity : proTextView) {
-                    const auto& transform = proTextView.get<TransformComponent>(textEntity);
-                    const auto& text = proTextView.get<TextComponentPro>(textEntity);
-                    
-                    // Draw the text with rotation
-                    render::DrawTextPro(
-                        text.font,
-                        str(text.text).c_str(),
-                        transform.position,
-                        {0, 0},
-                        transform.rotation,
-                        text.fontSize,
-                        text.spacing,
-                        text.tint
-                    );
-                }
-
-                // Draw all Pixel Perfect text components in a single batch
-                auto pPerfectTextView = registry.view<TransformComponent, TextComponentPixelPerfect>();
-                for (auto textEntity : pPerfectTextView) {
-                    const auto& transform = pPerfectTextView.get<TransformComponent>(textEntity);
-                    const auto& text = pPerfectTextView.get<TextComponentPixelPerfect>(textEntity);
-
-                    // Draw the text with rotation
-                    render::DrawTextPixelPerfect(
-                        text.font,
-                        str(text.text).c_str(),
-                        transform.position,
-                        text.fontSize,
-                        text.spacing,
-                        text.tint
-                    );
-                }
+            // Draw the game world using the world space camera
+            render::BeginMode2D(snapshot->worldCamera);
+            {
+                DrawItems(snapshot->dynamic);
             }
-            EndMode2D();
+            render::EndMode2D();
+
+            CompositeLayer(*frames, *snapshot, RenderLayer::Hud);
         }
-        EndTextureMode();
-        
+        render::EndTextureMode();
+
         // Draw the render texture to the screen using the screen space camera
-        BeginMode2D(camera.screenSpaceCamera);
+        render::BeginMode2D(snapshot->screenCamera);
         {
-            render::DrawTexturePro(camera.target.texture, 
-                camera.sourceRec, 
-                camera.destRec,
-                Vector2{0, 0}, 
-                0.0f, 
+            render::DrawTexturePro(snapshot->target.texture,
+                snapshot->sourceRec,
+                destRec,
+                Vector2{0, 0},
+                0.0f,
                 WHITE);
         }
-        EndMode2D();
-        
+        render::EndMode2D();
+
 #ifdef GDEBUG
         // Draw debug info
         render::DrawText(TextFormat("Screen resolution: %ix%i", screenWidth, screenHeight), 10, 10, UI_DEFAULT_FONT_SIZE, DARKBLUE);
         render::DrawText(TextFormat("World resolution: %ix%i", VIRTUAL_WIDTH, VIRTUAL_HEIGHT), 10, 40, UI_DEFAULT_FONT_SIZE, DARKGREEN);
         render::DrawText(TextFormat("Viewport: %ix%i", viewportWidth, viewportHeight), 10, 70, UI_DEFAULT_FONT_SIZE, DARKGREEN);
+        render::DrawText(TextFormat("Submitted: %u Culled: %u", snapshot->submitted, snapshot->culled), 10, 100, UI_DEFAULT_FONT_SIZE, DARKGREEN);
+
+        // Renderer cost of the previous frame
+        const render::RenderStats& stats = render::GetRenderStats();
+        render::DrawText(TextFormat("Commands: %u Vertices: %u", stats.commands, stats.vertices), 10, 130, UI_DEFAULT_FONT_SIZE, DARKGREEN);
+        render::DrawText(TextFormat("Textures: %u States: %u Flushes (est): %u", stats.textureSwitches, stats.stateSwitches, stats.estimatedBatchFlushes), 10, 160, UI_DEFAULT_FONT_SIZE, DARKGREEN);
+        render::DrawText(TextFormat("EndDrawing: %.2fms", stats.endDrawingMs), 10, 190, UI_DEFAULT_FONT_SIZE, DARKGREEN);
+
+        const auto residency = AssetManager::GetResidencyReport();
+        render::DrawText(TextFormat("Assets: %.1f/%.0f MB Evicted: %u Reloads: %llu",
+                                    static_cast<double>(residency.residentBytes) / (1024.0 * 1024.0),
+                                    static_cast<double>(residency.budgetBytes) / (1024.0 * 1024.0),
+                                    residency.evictedTextures, residency.reloads),
+                         10, 220, UI_DEFAULT_FONT_SIZE, DARKGREEN);
         render::DrawFPS(screenWidth - 95, 10);
 #endif
     }
 
 private:
     static constexpr int DEFAULT_FONT_SIZE = UI_DEFAULT_FONT_SIZE;
+
+    static RenderLayer LayerOf(entt::registry& registry, entt::entity entity) {
+        const auto* layer = registry.try_get<RenderLayerComponent>(entity);
+        return layer != nullptr ? layer->layer : RenderLayer::Dynamic;
+    }
+
+    static bool SameCamera(const Camera2D& a, const Camera2D& b) {
+        return a.offset.x == b.offset.x && a.offset.y == b.offset.y &&
+               a.target.x == b.target.x && a.target.y == b.target.y &&
+               a.rotation == b.rotation && a.zoom == b.zoom;
+    }
+
+    static void OnRenderableChanged(entt::registry& registry, entt::entity entity) {
+        auto* cache = registry.ctx().find<RenderLayerCache>();
+        if (cache == nullptr) return;
+
+        const RenderLayer layer = LayerOf(registry, entity);
+        if (layer != RenderLayer::Dynamic) {
+            ++cache->layers[static_cast<size_t>(layer)].version;
+            ++cache->layers[static_cast<size_t>(layer)].contentVersion;
+        }
+    }
+
+    template<typename Component>
+    static void ConnectLayerSignals(entt::registry& registry) {
+        registry.on_construct<Component>().template connect<&RenderSystem::OnRenderableChanged>();
+        registry.on_update<Component>().template connect<&RenderSystem::OnRenderableChanged>();
+        registry.on_destroy<Component>().template connect<&RenderSystem::OnRenderableChanged>();
+    }
+
+    template<typename Component>
+    static void DisconnectLayerSignals(entt::registry& registry) {
+        registry.on_construct<Component>().template disconnect<&RenderSystem::OnRenderableChanged>();
+        registry.on_update<Component>().template disconnect<&RenderSystem::OnRenderableChanged>();
+        registry.on_destroy<Component>().template disconnect<&RenderSystem::OnRenderableChanged>();
+    }
+
+    static void Extract(entt::registry& registry, RenderSnapshot& snapshot) {
+        snapshot.dynamic.Clear();
+        snapshot.submitted = 0;
+        snapshot.culled = 0;
+
+        const auto view = registry.view<PixelPerfectCameraComponent>();
+        snapshot.hasCamera = !view.empty();
+        if (!snapshot.hasCamera) return;
+
+        const auto& camera = view.get<PixelPerfectCameraComponent>(view.front());
+        snapshot.worldCamera = camera.worldSpaceCamera;
+        snapshot.screenCamera = camera.screenSpaceCamera;
+        snapshot.target = camera.target;
+        snapshot.sourceRec = camera.sourceRec;
+
+        // Cached layers are in world space, so any camera movement invalidates them
+        auto& cache = registry.ctx().get<RenderLayerCache>();
+        if (!SameCamera(cache.camera, camera.worldSpaceCamera)) {
+            cache.camera = camera.worldSpaceCamera;
+            for (auto& layer : cache.layers) ++layer.version;
+        }
+
+        const Rectangle viewBounds = render::GetCameraViewBounds(camera.worldSpaceCamera,
+            static_cast<float>(camera.target.texture.width), static_cast<float>(camera.target.texture.height));
+
+        for (size_t i = 0; i < RenderSnapshot::LAYER_COUNT; ++i) {
+            const auto layer = static_cast<RenderLayer>(i);
+            if (layer == RenderLayer::Dynamic) continue;
+
+            // Untouched layers hand the same draw list to every snapshot
+            auto& cached = cache.layers[i];
+            if (cached.extractedVersion != cached.version) {
+                auto items = std::make_shared<RenderSnapshot::LayerItems>();
+                ExtractLayer(registry, layer, viewBounds, *items, snapshot);
+                cached.extractedVersion = cached.version;
+                // Extract again once the evicted textures are back
+                if (items->incomplete) ++cached.version;
+                cached.items = items->Empty() ? nullptr : std::move(items);
+            }
+            snapshot.cachedLayers[i] = cached.items;
+            snapshot.layerVersions[i] = cached.version;
+        }
+
+        ExtractLayer(registry, RenderLayer::Dynamic, viewBounds, snapshot.dynamic, snapshot);
+    }
+
+    static void RefreshLayer(RenderFrameState& frames, const RenderSnapshot& snapshot, RenderLayer layer) {
+        const auto index = static_cast<size_t>(layer);
+        auto& cached = frames.layers[index];
+        if (cached.renderedVersion == snapshot.layerVersions[index]) return;
+        cached.renderedVersion = snapshot.layerVersions[index];
+
+        // Layers nobody uses don't hold on to a render texture
+        const auto& items = snapshot.cachedLayers[index];
+        if (!items) {
+            render::ReleaseRenderTarget(cached.target);
+            cached.target = RenderTexture2D{};
+            return;
+        }
+
+        if (cached.target.id == 0) {
+            cached.target = render::AcquireRenderTarget(snapshot.target.texture.width, snapshot.target.texture.height);
+        }
+
+        // Drawn so the target stores premultiplied colour, which CompositeLayer then expects
+        render::BeginTextureMode(cached.target);
+        {
+            ClearBackground(BLANK);
+            render::BeginBlendMode(render::BLEND_LAYER_TARGET);
+            render::BeginMode2D(snapshot.worldCamera);
+            {
+                DrawItems(*items);
+            }
+            render::EndMode2D();
+            render::EndBlendMode();
+        }
+        render::EndTextureMode();
+    }
+
+    static void CompositeLayer(const RenderFrameState& frames, const RenderSnapshot& snapshot, RenderLayer layer) {
+        const auto index = static_cast<size_t>(layer);
+        if (!snapshot.cachedLayers[index] || frames.layers[index].target.id == 0) return;
+
+        // The layer texture holds premultiplied colour, see RefreshLayer
+        render::BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+        render::DrawTextureRec(frames.layers[index].target.texture, snapshot.sourceRec, Vector2{0, 0}, WHITE);
+        render::EndBlendMode();
+    }
+
+    static Rectangle TextBounds(const TransformComponent& transform, std::string_view text, float fontSize, float spacing) {
+        // Conservative estimate, glyph advances stay within fontSize + spacing
+        const float width = static_cast<float>(text.size()) * (fontSize + spacing);
+        return RotatedBounds(transform.position, Vector2{0.0f, 0.0f}, Vector2{width, fontSize}, transform.rotation);
+    }
+
+    // AABB of a size-sized box placed at `position` with `origin`, rotated around `position`
+    static Rectangle RotatedBounds(Vector2 position, Vector2 origin, Vector2 size, float rotation) {
+        if (rotation == 0.0f) {
+            return Rectangle{position.x - origin.x, position.y - origin.y, size.x, size.y};
+        }
+        const float farX = std::max(origin.x, size.x - origin.x);
+        const float farY = std::max(origin.y, size.y - origin.y);
+        const float radius = std::sqrt(farX * farX + farY * farY);
+        return Rectangle{position.x - radius, position.y - radius, radius * 2.0f, radius * 2.0f};
+    }
+
+    template<typename Component>
+    static u64 IndexKey(RenderLayer layer) {
+        return (static_cast<u64>(layer) << 32) | entt::type_hash<Component>::value();
+    }
+
+    // Gathers the layer's bounds into SoA scratch, culls them in one pass, then records the
+    // survivors. Cached layers with enough entries keep the gathered bounds in a RenderCullIndex,
+    // and until their content changes later extracts query its grid instead.
+    template<typename Component, typename Bounds, typename Emit>
+    static void ExtractCulled(entt::registry& registry, RenderLayer layer, const Rectangle& viewBounds,
+                              RenderSnapshot& snapshot, Bounds&& bounds, Emit&& emit) {
+        auto& cull = registry.ctx().get<RenderCullState>();
+        auto view = registry.view<TransformComponent, Component>();
+
+        u64 contentVersion = 0;
+        RenderCullIndex* index = nullptr;
+        if (layer != RenderLayer::Dynamic) {
+            contentVersion = registry.ctx().get<RenderLayerCache>().layers[static_cast<size_t>(layer)].contentVersion;
+            if (const auto it = cull.indices.find(IndexKey<Component>(layer)); it != cull.indices.end()) {
+                index = &it->second;
+            }
+        }
+
+        if (index != nullptr && index->contentVersion == contentVersion) {
+            ExtractIndexed<Component>(*index, cull, view, viewBounds, snapshot, emit);
+            return;
+        }
+
+        cull.Clear();
+        for (auto entity : view) {
+            if (LayerOf(registry, entity) != layer) continue;
+            cull.Push(entity, bounds(view.template get<TransformComponent>(entity), view.template get<Component>(entity)));
+        }
+
+        const size_t count = cull.entities.size();
+        cull.visible.resize(count);
+        const size_t visibleCount = render::CullBounds(cull.minX.data(), cull.minY.data(), cull.maxX.data(), cull.maxY.data(),
+                                                       count, viewBounds, cull.visible.data());
+        snapshot.submitted += static_cast<u32>(visibleCount);
+        snapshot.culled += static_cast<u32>(count - visibleCount);
+
+        for (size_t i = 0; i < count; ++i) {
+            if (!cull.visible[i]) continue;
+            const auto entity = cull.entities[i];
+            emit(view.template get<TransformComponent>(entity), view.template get<Component>(entity));
+        }
+
+        if (layer == RenderLayer::Dynamic) return;
+        if (count < MIN_INDEXED_BOUNDS) {
+            cull.indices.erase(IndexKey<Component>(layer));
+            return;
+        }
+        BuildIndex(cull, cull.indices[IndexKey<Component>(layer)], contentVersion);
+    }
+
+    static void BuildIndex(const RenderCullState& cull, RenderCullIndex& index, u64 contentVersion) {
+        index.contentVersion = contentVersion;
+        index.entities = cull.entities;
+        index.minX = cull.minX;
+        index.minY = cull.minY;
+        index.maxX = cull.maxX;
+        index.maxY = cull.maxY;
+
+        // Sized to the layer's extent, so nothing piles up in the border cells
+        const float left = *std::ranges::min_element(index.minX);
+        const float top = *std::ranges::min_element(index.minY);
+        const float right = *std::ranges::max_element(index.maxX);
+        const float bottom = *std::ranges::max_element(index.maxY);
+        index.grid.Reset(Rectangle{left, top, right - left, bottom - top}, RENDER_GRID_CELL_SIZE);
+        index.grid.Build(index.minX.data(), index.minY.data(), index.maxX.data(), index.maxY.data(), index.entities.size());
+    }
+
+    template<typename Component, typename View, typename Emit>
+    static void ExtractIndexed(const RenderCullIndex& index, RenderCullState& cull, const View& view,
+                               const Rectangle& viewBounds, RenderSnapshot& snapshot, Emit&& emit) {
+        const float right = viewBounds.x + viewBounds.width;
+        const float bottom = viewBounds.y + viewBounds.height;
+
+        cull.candidates.clear();
+        index.grid.Query(viewBounds, [&](u32 i) {
+            if (index.maxX[i] >= viewBounds.x && index.minX[i] <= right &&
+                index.maxY[i] >= viewBounds.y && index.minY[i] <= bottom) {
+                cull.candidates.push_back(i);
+            }
+            return true;
+        });
+
+        // The grid visits by cell, draws have to keep the sweep's order
+        std::ranges::sort(cull.candidates);
+        snapshot.submitted += static_cast<u32>(cull.candidates.size());
+        snapshot.culled += static_cast<u32>(index.entities.size() - cull.candidates.size());
+
+        for (const u32 i : cull.candidates) {
+            const auto entity = index.entities[i];
+            emit(view.template get<TransformComponent>(entity), view.template get<Component>(entity));
+        }
+    }
+
+    static void ExtractLayer(entt::registry& registry, RenderLayer layer, const Rectangle& viewBounds,
+                             RenderSnapshot::LayerItems& items, RenderSnapshot& snapshot) {
+        // Tilemaps pick their visible chunks directly, no per-tile culling needed
+        auto tilemaps = registry.view<TransformComponent, TilemapComponent>();
+        for (auto entity : tilemaps) {
+            if (LayerOf(registry, entity) != layer) continue;
+            if (!TilemapSystem::CollectVisibleChunks(tilemaps.get<TransformComponent>(entity), tilemaps.get<TilemapComponent>(entity),
+                                                     viewBounds, items.tileChunks)) {
+                items.incomplete = true;
+            }
+        }
+
+        ExtractCulled<RectangleComponent>(registry, layer, viewBounds, snapshot,
+            [](const TransformComponent& transform, const RectangleComponent& rect) {
+                return RotatedBounds(Vector2{rect.rectangle.x, rect.rectangle.y}, Vector2{0.0f, 0.0f},
+                                     Vector2{rect.rectangle.width, rect.rectangle.height}, transform.rotation);
+            },
+            [&items](const TransformComponent& transform, const RectangleComponent& rect) {
+                items.rectangles.push_back({rect.rectangle, transform.rotation, rect.color});
+            });
+
+        ExtractCulled<SpriteComponent>(registry, layer, viewBounds, snapshot,
+            [](const TransformComponent& transform, const SpriteComponent& sprite) {
+                return RotatedBounds(transform.position, Vector2{sprite.size.x / 2, sprite.size.y / 2}, sprite.size, transform.rotation);
+            },
+            [&items](const TransformComponent& transform, const SpriteComponent& sprite) {
+                if (!sprite.texture.IsValid()) return;
+                const Texture* texture = sprite.texture.Resolve();
+                if (texture == nullptr) {
+                    items.incomplete = true;  // Evicted, back in a frame or two
+                    return;
+                }
+
+                // Atlased sprites only cover part of their texture page
+                const Rectangle srcRec = (sprite.source.width != 0.0f) ? sprite.source : Rectangle{
+                    0.0f, 0.0f,
+                    static_cast<float>(texture->width),
+                    static_cast<float>(texture->height)
+                };
+
+                items.sprites.push_back({
+                    *texture,
+                    srcRec,
+                    Rectangle{transform.position.x, transform.position.y, sprite.size.x, sprite.size.y},
+                    Vector2{sprite.size.x / 2, sprite.size.y / 2},  // Set origin to center of sprite
+                    transform.rotation,
+                    sprite.tint
+                });
+            });
+
+        if (layer == RenderLayer::Dynamic) {
+            ExtractBullets(registry, viewBounds, items, snapshot);
+        }
+
+        ExtractCulled<TextComponent>(registry, layer, viewBounds, snapshot,
+            [](const TransformComponent& transform, const TextComponent& text) {
+                return TextBounds(transform, text.text, static_cast<float>(text.fontSize), static_cast<float>(text.fontSize) / 10.0f);
+            },
+            [&items](const TransformComponent& transform, const TextComponent& text) {
+                items.texts.push_back({
+                    str(text.text),
+                    static_cast<int>(transform.position.x),
+                    static_cast<int>(transform.position.y),
+                    text.fontSize,
+                    text.color
+                });
+            });
+
+        ExtractCulled<TextComponentPro>(registry, layer, viewBounds, snapshot,
+            [](const TransformComponent& transform, const TextComponentPro& text) {
+                const auto& layout = text.layout.Resolve(text.font, text.text, static_cast<float>(text.fontSize), text.spacing);
+                return RotatedBounds(transform.position, Vector2{0.0f, 0.0f}, layout.size, transform.rotation);
+            },
+            [&items](const TransformComponent& transform, const TextComponentPro& text) {
+                items.layoutTexts.push_back({text.font, text.layout.layout, transform.position, transform.rotation, text.tint});
+            });
+
+        ExtractCulled<TextComponentPixelPerfect>(registry, layer, viewBounds, snapshot,
+            [](const TransformComponent& transform, const TextComponentPixelPerfect& text) {
+                // Pixel perfect text snaps its spacing to whole pixels
+                const auto& layout = text.layout.Resolve(text.font, text.text, static_cast<float>(text.fontSize), roundf(text.spacing));
+                return RotatedBounds(transform.position, Vector2{0.0f, 0.0f}, layout.size, 0.0f);
+            },
+            [&items](const TransformComponent& transform, const TextComponentPixelPerfect& text) {
+                const Vector2 pixelPosition = {roundf(transform.position.x), roundf(transform.position.y)};
+                items.layoutTexts.push_back({text.font, text.layout.layout, pixelPosition, 0.0f, text.tint});
+            });
+    }
+
+    // Pooled bullets are culled straight from the BulletPool arrays, no entities involved
+    static void ExtractBullets(entt::registry& registry, const Rectangle& viewBounds,
+                               RenderSnapshot::LayerItems& items, RenderSnapshot& snapshot) {
+        const auto* pool = registry.ctx().find<BulletPool>();
+        if (pool == nullptr || pool->Size() == 0 || !pool->texture.IsValid()) return;
+
+        const Texture* texture = pool->texture.Resolve();
+        if (texture == nullptr) {
+            items.incomplete = true;  // Evicted, back in a frame or two
+            return;
+        }
+
+        // Bullets spin with their angle, a circle around the centre covers every rotation
+        const size_t count = pool->Size();
+        auto& cull = registry.ctx().get<RenderCullState>();
+        cull.Clear();
+        cull.minX.resize(count);
+        cull.minY.resize(count);
+        cull.maxX.resize(count);
+        cull.maxY.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            const float radius = std::sqrt(pool->width[i] * pool->width[i] + pool->height[i] * pool->height[i]) / 2.0f;
+            cull.minX[i] = pool->x[i] - radius;
+            cull.minY[i] = pool->y[i] - radius;
+            cull.maxX[i] = pool->x[i] + radius;
+            cull.maxY[i] = pool->y[i] + radius;
+        }
+
+        cull.visible.resize(count);
+        render::CullBounds(cull.minX.data(), cull.minY.data(), cull.maxX.data(), cull.maxY.data(),
+                           count, viewBounds, cull.visible.data());
+
+        const Rectangle srcRec = (pool->source.width != 0.0f) ? pool->source : Rectangle{
+            0.0f, 0.0f,
+            static_cast<float>(texture->width),
+            static_cast<float>(texture->height)
+        };
+
+        u32 submitted = 0;
+        for (size_t i = 0; i < count; ++i) {
+            // Bullets spent this frame stay in the pool until the next update
+            if (!(cull.visible[i] & pool->alive[i])) continue;
+            ++submitted;
+            items.sprites.push_back({
+                *texture,
+                srcRec,
+                Rectangle{pool->x[i], pool->y[i], pool->width[i], pool->height[i]},
+                Vector2{pool->width[i] / 2, pool->height[i] / 2},
+                pool->rotation[i],
+                pool->type[i] == BulletType::Player ? YELLOW : RED
+            });
+        }
+        snapshot.submitted += submitted;
+        snapshot.culled += static_cast<u32>(count) - submitted;
+    }
+
+    static void DrawItems(const RenderSnapshot::LayerItems& items) {
+        // Tilemap chunks go underneath everything else on the layer
+        for (const auto& chunk : items.tileChunks) {
+            render::DrawTexturedQuads(chunk.texture, *chunk.quads, chunk.position, {0, 0}, 0.0f, chunk.tint);
+        }
+
+        // Draw all rectangles in a single batch
+        for (const auto& rect : items.rectangles) {
+            render::DrawRectanglePro(rect.rectangle, { 0.0f, 0.0f }, rect.rotation, rect.color);
+        }
+
+        // Draw all sprites in a single batch
+        for (const auto& sprite : items.sprites) {
+            render::DrawTexturePro(sprite.texture, sprite.source, sprite.dest, sprite.origin, sprite.rotation, sprite.tint);
+        }
+
+        // Draw all text components in a single batch
+        for (const auto& text : items.texts) {
+            render::DrawText(text.text.c_str(), text.x, text.y, text.fontSize, text.color);
+        }
+
+        // Draw the cached glyph quads of Pro and Pixel Perfect text
+        for (const auto& text : items.layoutTexts) {
+            render::DrawTextLayout(text.font, *text.layout, text.position, {0, 0}, text.rotation, text.tint);
+        }
+    }
 };
 
 #endif //RENDERSYSTEM_H
@@ -13,6 +13,7 @@ public:
         FixedUpdate,
         AsyncUpdate,
         Draw,
+        Publish,  // Copies render state out after Update, may run on the simulation thread
         Count  // Keep this last for array sizing
     };
 
@@ -0,0 +1,164 @@
+#ifndef TILEMAPSYSTEM_H
+#define TILEMAPSYSTEM_H
+
+#include <entt/entt.hpp>
+#include <cmath>
+#include <numeric>
+
+#include "AssetManager.h"
+#include "RenderSnapshot.h"
+#include "components/BasicComponent.h"
+#include "components/TilemapComponent.h"
+
+// Scrolls tilemaps and feeds their visible chunks to the renderer. Only chunks in view
+// are kept, so the per-frame cost depends on the viewport, never on the map size.
+class TilemapSystem {
+public:
+    static void Update(entt::registry& registry, float deltaTime) {
+        auto view = registry.view<TransformComponent, TilemapComponent>();
+        for (auto entity : view) {
+            const auto& tilemap = view.get<TilemapComponent>(entity);
+            if (tilemap.scrollSpeed == 0.0f) continue;
+
+            registry.patch<TransformComponent>(entity, [&](TransformComponent& transform) {
+                transform.position.y += tilemap.scrollSpeed * deltaTime;
+
+                // Wrap by a whole number of chunk periods so chunk keys, and the cache, stay valid
+                if (tilemap.repeatRows && tilemap.height > 0) {
+                    const float period = static_cast<float>(PeriodChunks(tilemap) * TilemapComponent::CHUNK_SIZE) * tilemap.tileSize.y;
+                    transform.position.y = std::fmod(transform.position.y, period);
+                }
+            });
+        }
+    }
+
+    static void SetTile(entt::registry& registry, entt::entity entity, i32 x, i32 y, u16 tile) {
+        registry.patch<TilemapComponent>(entity, [x, y, tile](TilemapComponent& tilemap) {
+            if (x < 0 || x >= tilemap.width || y < 0 || y >= tilemap.height) return;
+            tilemap.tiles[static_cast<size_t>(y) * tilemap.width + x] = tile;
+
+            // A repeating row shows up in several chunks of the column
+            const i32 chunkX = x / TilemapComponent::CHUNK_SIZE;
+            const i32 chunkY = y / TilemapComponent::CHUNK_SIZE;
+            std::erase_if(tilemap.chunks, [&](const auto& entry) {
+                return KeyColumn(entry.first) == chunkX && (tilemap.repeatRows || KeyRow(entry.first) == chunkY);
+            });
+        });
+    }
+
+    // Appends a draw item for every chunk overlapping the view, building the ones that just came into view.
+    // Returns false while the tileset is evicted and reloading.
+    static bool CollectVisibleChunks(const TransformComponent& transform, const TilemapComponent& tilemap,
+                                     const Rectangle& viewBounds, std::vector<RenderSnapshot::TileChunkItem>& out) {
+        if (tilemap.width <= 0 || tilemap.height <= 0 || tilemap.tileset == AssetId{}) return true;
+        if (tilemap.tiles.size() < static_cast<size_t>(tilemap.width) * tilemap.height) return true;
+
+        const auto& tileset = AssetManager::GetTextureData(tilemap.tileset);
+        if (tileset.texture.id == 0) return false;
+        const u64 frame = ++tilemap.frame;
+
+        const float chunkWidth = static_cast<float>(TilemapComponent::CHUNK_SIZE) * tilemap.tileSize.x;
+        const float chunkHeight = static_cast<float>(TilemapComponent::CHUNK_SIZE) * tilemap.tileSize.y;
+
+        // View in map-local space
+        const float localX = viewBounds.x - transform.position.x;
+        const float localY = viewBounds.y - transform.position.y;
+
+        const i32 columns = (tilemap.width + TilemapComponent::CHUNK_SIZE - 1) / TilemapComponent::CHUNK_SIZE;
+        const i32 rows = (tilemap.height + TilemapComponent::CHUNK_SIZE - 1) / TilemapComponent::CHUNK_SIZE;
+
+        i32 firstX = static_cast<i32>(std::floor(localX / chunkWidth));
+        i32 lastX = static_cast<i32>(std::ceil((localX + viewBounds.width) / chunkWidth)) - 1;
+        i32 firstY = static_cast<i32>(std::floor(localY / chunkHeight));
+        i32 lastY = static_cast<i32>(std::ceil((localY + viewBounds.height) / chunkHeight)) - 1;
+
+        firstX = std::max(firstX, 0);
+        lastX = std::min(lastX, columns - 1);
+        if (!tilemap.repeatRows) {
+            firstY = std::max(firstY, 0);
+            lastY = std::min(lastY, rows - 1);
+        }
+
+        const i32 periodChunks = PeriodChunks(tilemap);
+        for (i32 chunkY = firstY; chunkY <= lastY; ++chunkY) {
+            // Repeating maps alias chunk rows that hold the same tiles
+            const i32 keyRow = tilemap.repeatRows ? FloorMod(chunkY, periodChunks) : chunkY;
+
+            for (i32 chunkX = firstX; chunkX <= lastX; ++chunkX) {
+                auto& chunk = tilemap.chunks[MakeKey(chunkX, keyRow)];
+                if (!chunk.quads) {
+                    chunk.quads = BuildChunk(tilemap, tileset, chunkX, keyRow);
+                }
+                chunk.lastVisibleFrame = frame;
+
+                if (chunk.quads->empty()) continue;
+                out.push_back({
+                    tileset.texture,
+                    chunk.quads,
+                    Vector2{
+                        transform.position.x + static_cast<float>(chunkX) * chunkWidth,
+                        transform.position.y + static_cast<float>(chunkY) * chunkHeight
+                    },
+                    tilemap.tint
+                });
+            }
+        }
+
+        // Chunks that scrolled out are dropped, keeping the cache bounded by the view
+        std::erase_if(tilemap.chunks, [frame](const auto& entry) {
+            return entry.second.lastVisibleFrame != frame;
+        });
+        return true;
+    }
+
+private:
+    static u64 MakeKey(i32 chunkX, i32 chunkY) {
+        return (static_cast<u64>(static_cast<u32>(chunkY)) << 32) | static_cast<u32>(chunkX);
+    }
+
+    static i32 KeyColumn(u64 key) { return static_cast<i32>(static_cast<u32>(key)); }
+    static i32 KeyRow(u64 key) { return static_cast<i32>(static_cast<u32>(key >> 32)); }
+
+    static i32 FloorMod(i32 value, i32 divisor) {
+        const i32 result = value % divisor;
+        return result < 0 ? result + divisor : result;
+    }
+
+    // Chunk rows after which a repeating map lines up with the chunk grid again
+    static i32 PeriodChunks(const TilemapComponent& tilemap) {
+        return tilemap.height / std::gcd(tilemap.height, TilemapComponent::CHUNK_SIZE);
+    }
+
+    static std::shared_ptr<const std::vector<render::TexturedQuad>> BuildChunk(
+            const TilemapComponent& tilemap, const AssetManager::TextureData& tileset, i32 chunkX, i32 chunkY) {
+        auto quads = std::make_shared<std::vector<render::TexturedQuad>>();
+        quads->reserve(TilemapComponent::CHUNK_SIZE * TilemapComponent::CHUNK_SIZE);
+
+        const auto uvCount = static_cast<u16>(std::min<size_t>(tileset.tileUVs.size(), TilemapComponent::EMPTY_TILE));
+        for (i32 y = 0; y < TilemapComponent::CHUNK_SIZE; ++y) {
+            i32 row = chunkY * TilemapComponent::CHUNK_SIZE + y;
+            if (tilemap.repeatRows) {
+                row = FloorMod(row, tilemap.height);
+            } else if (row >= tilemap.height) {
+                break;
+            }
+
+            const u16* tileRow = tilemap.tiles.data() + static_cast<size_t>(row) * tilemap.width;
+            for (i32 x = 0; x < TilemapComponent::CHUNK_SIZE; ++x) {
+                const i32 column = chunkX * TilemapComponent::CHUNK_SIZE + x;
+                if (column >= tilemap.width) break;
+
+                const u16 tile = tileRow[column];
+                if (tile >= uvCount) continue;  // Empty or outside the tileset
+
+                const auto& uv = tileset.tileUVs[tile];
+                const float x0 = static_cast<float>(x) * tilemap.tileSize.x;
+                const float y0 = static_cast<float>(y) * tilemap.tileSize.y;
+                quads->push_back({x0, y0, x0 + tilemap.tileSize.x, y0 + tilemap.tileSize.y, uv.u0, uv.v0, uv.u1, uv.v1});
+            }
+        }
+        return quads;
+    }
+};
+
+#endif //TILEMAPSYSTEM_H
@@ -0,0 +1,98 @@
+// Compares AssetManager's old string lookup (intern through std::string, then an
+// unordered_map keyed by string_view) with hashed AssetId lookups into AssetIdMap.
+//
+// Usage: asset_lookup_bench [--assets N] [--lookups N]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "AssetId.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct FakeAsset {
+        u32 id;
+    };
+
+    // Defeats dead-code elimination of the lookups
+    volatile u64 sink = 0;
+
+    template<typename Lookup>
+    double Measure(int lookups, size_t assetCount, Lookup&& lookup) {
+        u64 sum = 0;
+        const auto start = Clock::now();
+        for (int i = 0; i < lookups; ++i) {
+            sum += lookup(static_cast<size_t>(i) % assetCount);
+        }
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        sink = sink + sum;
+        return ns / lookups;
+    }
+}
+
+int main(int argc, char** argv) {
+    int assetCount = 64;
+    int lookups = 10'000'000;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--assets") == 0 && i + 1 < argc) {
+            assetCount = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--lookups") == 0 && i + 1 < argc) {
+            lookups = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "Usage: %s [--assets N] [--lookups N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<std::string> names;
+    std::vector<FakeAsset> assets(static_cast<size_t>(assetCount));
+    for (int i = 0; i < assetCount; ++i) {
+        names.push_back("sprites/enemy_variant_" + std::to_string(i));
+        assets[i].id = static_cast<u32>(i);
+    }
+
+    // Old path: InternString + unordered_map<string_view>::at
+    std::unordered_set<std::string> stringPool;
+    std::unordered_map<std::string_view, FakeAsset> byName;
+    for (size_t i = 0; i < names.size(); ++i) {
+        byName.emplace(*stringPool.emplace(names[i]).first, assets[i]);
+    }
+
+    // New path: AssetIdMap of pointers into stable storage
+    AssetIdMap<FakeAsset*> byId;
+    std::vector<AssetId> ids;
+    for (size_t i = 0; i < names.size(); ++i) {
+        ids.emplace_back(names[i]);
+        byId.Insert(ids.back(), &assets[i]);
+    }
+
+    const std::vector<std::string_view> views(names.begin(), names.end());
+    const auto n = names.size();
+
+    const double internNs = Measure(lookups, n, [&](size_t i) -> u64 {
+        std::string key(views[i]);
+        const auto it = stringPool.find(key);
+        return byName.at(*it).id;
+    });
+    const double runtimeHashNs = Measure(lookups, n, [&](size_t i) -> u64 {
+        return (*byId.Find(AssetId(views[i])))->id;
+    });
+    const double precomputedNs = Measure(lookups, n, [&](size_t i) -> u64 {
+        return (*byId.Find(ids[i]))->id;
+    });
+
+    std::printf("%d assets, %d lookups\n", assetCount, lookups);
+    std::printf("  %-28s %8.2f ns/lookup\n", "InternString + unordered_map", internNs);
+    std::printf("  %-28s %8.2f ns/lookup\n", "AssetId(name) + AssetIdMap", runtimeHashNs);
+    std::printf("  %-28s %8.2f ns/lookup\n", "constexpr AssetId + AssetIdMap", precomputedNs);
+    return 0;
+}
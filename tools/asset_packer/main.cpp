@@ -0,0 +1,35 @@
+// Bundles asset directories into a single archive that AssetManager memory maps at startup.
+// Runs as a build step; see PACK_ASSETS in the top-level CMakeLists.txt. Extra directories hold
+// generated assets (baked fonts) and are merged under the same relative paths.
+//
+// Usage: asset_packer <asset directory> <output.pak> [generated asset directory...]
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "AssetPack.h"
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Usage: %s <asset directory> <output.pak> [generated asset directory...]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<std::string> directories{argv[1]};
+    directories.insert(directories.end(), argv + 3, argv + argc);
+
+    std::string error;
+    if (!pack::Write(directories, argv[2], error)) {
+        std::fprintf(stderr, "asset_packer: %s\n", error.c_str());
+        return 1;
+    }
+
+    pack::Archive archive;
+    if (!archive.Open(argv[2])) {
+        std::fprintf(stderr, "asset_packer: %s failed validation\n", argv[2]);
+        return 1;
+    }
+    std::printf("Packed %u files into %s\n", archive.GetEntryCount(), argv[2]);
+    return 0;
+}
@@ -0,0 +1,132 @@
+// Times one bullet tick (move, off-screen cull, drop the dead) for the old per-bullet loop,
+// which took sin/cos of every bullet's angle and rewrote its size and tint each frame, against
+// the SoA BulletPool. Bullets fly in random directions over the VIRTUAL_WIDTH x VIRTUAL_HEIGHT
+// playfield and are topped back up after every tick, so both sides keep the same live count.
+// The pool only compacts every few ticks, so its time is the average over all of them.
+//
+// Usage: bullet_bench [--ticks N] [--seed N]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "systems/BulletPool.h"
+#include "GameConfig.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float DELTA_FACTOR = 1.0f;  // One 60 Hz tick
+    constexpr Rectangle KEEP{-10.0f, -10.0f, VIRTUAL_WIDTH + 20.0f, VIRTUAL_HEIGHT + 20.0f};
+
+    // What the old BulletSystem touched per bullet, minus the registry
+    struct OldBullet {
+        Vector2 position;
+        float angle;
+        u8 speed;
+        u8 size;
+        BulletType type;
+        Vector2 spriteSize;
+        Color tint;
+    };
+
+    struct Spawner {
+        std::mt19937 rng;
+        std::uniform_real_distribution<float> x{0.0f, VIRTUAL_WIDTH};
+        std::uniform_real_distribution<float> y{0.0f, VIRTUAL_HEIGHT};
+        std::uniform_real_distribution<float> angle{0.0f, 360.0f};
+        std::uniform_int_distribution<int> speed{ENEMY_BULLET_SPEED, PLAYER_DEFAULT_BULLET_SPEED};
+
+        explicit Spawner(unsigned seed) : rng(seed) {}
+
+        OldBullet Next() {
+            const BulletType type = (rng() & 1) ? BulletType::Player : BulletType::Enemy;
+            return {Vector2{x(rng), y(rng)}, angle(rng), static_cast<u8>(speed(rng)), PLAYER_DEFAULT_BULLET_SIZE, type, {}, {}};
+        }
+    };
+
+    // Defeats dead-code elimination of the ticks
+    volatile double sink = 0.0;
+}
+
+int main(int argc, char** argv) {
+    int ticks = 200;
+    unsigned seed = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            ticks = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "Usage: %s [--ticks N] [--seed N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("%d ticks, %dx%d playfield\n", ticks, VIRTUAL_WIDTH, VIRTUAL_HEIGHT);
+    std::printf("  %8s %14s %14s %9s\n", "bullets", "old ms/tick", "pool ms/tick", "speedup");
+
+    for (const size_t bulletCount : {1'000u, 10'000u, 100'000u}) {
+        Spawner oldSpawner(seed);
+        std::vector<OldBullet> old;
+        while (old.size() < bulletCount) old.push_back(oldSpawner.Next());
+
+        double oldMs = 0.0;
+        size_t oldDropped = 0;
+        for (int tick = 0; tick < ticks; ++tick) {
+            const auto start = Clock::now();
+            for (auto& bullet : old) {
+                const float radAngle = bullet.angle * DEG2RAD;
+                bullet.position.x += std::sin(radAngle) * static_cast<float>(bullet.speed) * DELTA_FACTOR;
+                bullet.position.y += -std::cos(radAngle) * static_cast<float>(bullet.speed) * DELTA_FACTOR;
+                bullet.spriteSize = Vector2{BULLET_BASE_WIDTH * bullet.size, BULLET_BASE_HEIGHT * bullet.size};
+                bullet.tint = (bullet.type == BulletType::Player) ? YELLOW : RED;
+            }
+            const auto removed = std::ranges::remove_if(old, [](const OldBullet& bullet) {
+                return bullet.position.y < KEEP.y || bullet.position.y > KEEP.y + KEEP.height ||
+                       bullet.position.x < KEEP.x || bullet.position.x > KEEP.x + KEEP.width;
+            });
+            oldDropped += removed.size();
+            old.erase(removed.begin(), removed.end());
+            oldMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            while (old.size() < bulletCount) old.push_back(oldSpawner.Next());
+        }
+
+        Spawner poolSpawner(seed);
+        BulletPool pool;
+        const auto topUp = [&]() {
+            while (pool.liveCount < bulletCount) {
+                const OldBullet bullet = poolSpawner.Next();
+                pool.Spawn(bullet.position, bullet.angle, bullet.speed, bullet.size, PLAYER_DEFAULT_BULLET_DAMAGE, bullet.type);
+            }
+        };
+        topUp();
+
+        double poolMs = 0.0;
+        size_t poolDropped = 0;
+        for (int tick = 0; tick < ticks; ++tick) {
+            const size_t before = pool.liveCount;
+            const auto start = Clock::now();
+            pool.Update(DELTA_FACTOR, KEEP);
+            poolMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            poolDropped += before - pool.liveCount;
+            topUp();
+        }
+
+        oldMs /= ticks;
+        poolMs /= ticks;
+        sink = sink + old.front().position.x + pool.x.front();
+        std::printf("  %8zu %14.3f %14.3f %8.1fx\n", bulletCount, oldMs, poolMs, oldMs / poolMs);
+        if (oldDropped != poolDropped) {
+            std::fprintf(stderr, "Dropped bullets differ: old %zu, pool %zu\n", oldDropped, poolDropped);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+// Compares CollisionSystem's old brute-force broadphase (every player bullet against every
+// enemy) with the uniform SpatialGrid it uses now. Bullets and enemies are scattered over the
+// VIRTUAL_WIDTH x VIRTUAL_HEIGHT playfield with game-sized bounds; each run rebuilds the grid,
+// as the system does every pass. Outside the engine the queries run on one thread.
+//
+// Usage: collision_bench [--passes N] [--seed N]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "SpatialGrid.h"
+#include "GameConfig.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Bounds {
+        std::vector<float> minX, minY, maxX, maxY;
+
+        void Scatter(size_t count, float width, float height, std::mt19937& rng) {
+            std::uniform_real_distribution<float> x(0.0f, VIRTUAL_WIDTH - width);
+            std::uniform_real_distribution<float> y(0.0f, VIRTUAL_HEIGHT - height);
+            for (size_t i = 0; i < count; ++i) {
+                minX.push_back(x(rng));
+                minY.push_back(y(rng));
+                maxX.push_back(minX.back() + width);
+                maxY.push_back(minY.back() + height);
+            }
+        }
+
+        bool Overlaps(size_t i, const Bounds& other, size_t j) const {
+            return minX[i] < other.maxX[j] && maxX[i] > other.minX[j] &&
+                   minY[i] < other.maxY[j] && maxY[i] > other.minY[j];
+        }
+    };
+
+    // Defeats dead-code elimination of the tests
+    volatile u64 sink = 0;
+
+    template<typename Pass>
+    double Measure(int passes, Pass&& pass) {
+        u64 hits = 0;
+        const auto start = Clock::now();
+        for (int i = 0; i < passes; ++i) {
+            hits += pass();
+        }
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        sink = sink + hits;
+        return ms / passes;
+    }
+}
+
+int main(int argc, char** argv) {
+    int passes = 20;
+    unsigned seed = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--passes") == 0 && i + 1 < argc) {
+            passes = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "Usage: %s [--passes N] [--seed N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("%d passes, %dx%d playfield, %.0fpx cells\n", passes, VIRTUAL_WIDTH, VIRTUAL_HEIGHT, COLLISION_GRID_CELL_SIZE);
+    std::printf("  %8s %8s %14s %14s %9s\n", "bullets", "enemies", "brute ms/pass", "grid ms/pass", "speedup");
+
+    for (const size_t bulletCount : {1'000u, 10'000u, 50'000u}) {
+        for (const size_t enemyCount : {100u, 1'000u}) {
+            std::mt19937 rng(seed);
+            Bounds bullets;
+            Bounds enemies;
+            bullets.Scatter(bulletCount, BULLET_BASE_WIDTH, BULLET_BASE_HEIGHT, rng);
+            enemies.Scatter(enemyCount, ENEMY_SPRITE_SIZE, ENEMY_SPRITE_SIZE, rng);
+
+            u64 bruteHits = 0;
+            const double bruteMs = Measure(passes, [&]() -> u64 {
+                u64& hits = bruteHits = 0;
+                for (size_t i = 0; i < bulletCount; ++i) {
+                    for (size_t j = 0; j < enemyCount; ++j) {
+                        if (bullets.Overlaps(i, enemies, j)) {
+                            ++hits;
+                            break;
+                        }
+                    }
+                }
+                return hits;
+            });
+
+            SpatialGrid grid;
+            grid.Reset(Rectangle{0.0f, 0.0f, VIRTUAL_WIDTH, VIRTUAL_HEIGHT}, COLLISION_GRID_CELL_SIZE);
+            u64 gridHits = 0;
+            const double gridMs = Measure(passes, [&]() -> u64 {
+                u64& hits = gridHits = 0;
+                grid.Build(enemies.minX.data(), enemies.minY.data(), enemies.maxX.data(), enemies.maxY.data(), enemyCount);
+                for (size_t i = 0; i < bulletCount; ++i) {
+                    const Rectangle query{bullets.minX[i], bullets.minY[i], BULLET_BASE_WIDTH, BULLET_BASE_HEIGHT};
+                    grid.Query(query, [&](u32 j) {
+                        if (!bullets.Overlaps(i, enemies, j)) return true;
+                        ++hits;
+                        return false;
+                    });
+                }
+                return hits;
+            });
+
+            std::printf("  %8zu %8zu %14.3f %14.3f %8.1fx\n", bulletCount, enemyCount, bruteMs, gridMs, bruteMs / gridMs);
+            if (bruteHits != gridHits) {
+                std::fprintf(stderr, "Hit counts differ: brute force %llu, grid %llu\n", bruteHits, gridHits);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,257 @@
+// Stresses the epoch-protected snapshot reads behind AssetManager::ReadScope. Reader threads pin
+// snapshots and keep re-checking what they point at while the main thread publishes new ones,
+// retires the old ones and reclaims whatever no reader holds any more. Readers check that a
+// pinned snapshot never changes under them and that versions never go backwards; use-after-free
+// shows up as a failed check, or as a report when built with -fsanitize=thread or
+// -fsanitize=address (see tools/CMakeLists.txt).
+//
+// By default it runs headless against an EpochDomain with the same publish/retire sequence as
+// AssetManager::PublishLookups, so it needs no display or assets. --assets drives AssetManager
+// itself instead: the main thread keeps adding and removing a scene's textures and the readers
+// use ReadScope. That mode opens a hidden window for the GL context and has to run where assets/
+// or assets.pak resolves, e.g. the game's build directory.
+//
+// Usage: epoch_stress [--readers N] [--seconds N] [--assets] [--texture PATH]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "AssetManager.h"
+#include "EpochDomain.h"
+#include "raylib.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr i32 STRESS_SCENE = 0x5eed;
+    constexpr Vector2Int FRAME_SIZE{8, 8};
+    constexpr std::string_view ANIMATED_NAME = "epoch_stress_animated";
+    constexpr std::string_view SINGLE_NAME = "epoch_stress_single";
+    constexpr AssetId ANIMATED_TEXTURE{ANIMATED_NAME};
+    constexpr AssetId SINGLE_TEXTURE{SINGLE_NAME};
+    // Lookups per scope, long enough for several publishes to retire the pinned snapshot
+    constexpr int HOLD_PASSES = 64;
+    constexpr size_t PAYLOAD_SIZE = 64;
+
+    struct alignas(64) ReaderStats {
+        u64 scopes = 0;
+        u64 checks = 0;
+        u64 errors = 0;
+    };
+
+    // Headless stand-in for LookupSnapshot: every payload word holds the version
+    struct Snapshot {
+        u64 version;
+        std::vector<u64> payload;
+    };
+
+    EpochDomain domain;
+    std::atomic<const Snapshot*> published{nullptr};
+
+    void RunDomainReader(const std::atomic<bool>& running, ReaderStats& stats) {
+        u64 lastVersion = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            EpochDomain::ReadGuard guard(domain);
+            // Same ordering as ReadScope's constructor
+            const Snapshot* snapshot = published.load(std::memory_order_seq_cst);
+            if (snapshot == nullptr) continue;
+            ++stats.scopes;
+
+            if (snapshot->version < lastVersion) ++stats.errors;
+            lastVersion = snapshot->version;
+            for (int pass = 0; pass < HOLD_PASSES; ++pass) {
+                ++stats.checks;
+                if (snapshot->payload.size() != PAYLOAD_SIZE) {
+                    ++stats.errors;
+                    continue;
+                }
+                for (const u64 word : snapshot->payload) {
+                    if (word != snapshot->version) ++stats.errors;
+                }
+            }
+        }
+    }
+
+    u64 RunDomainWriter(const Clock::time_point deadline) {
+        u64 version = 0;
+        while (Clock::now() < deadline) {
+            ++version;
+            const Snapshot* previous = published.load(std::memory_order_relaxed);
+            published.store(new Snapshot{version, std::vector<u64>(PAYLOAD_SIZE, version)}, std::memory_order_seq_cst);
+            if (previous != nullptr) {
+                domain.Retire([previous] {
+                    // Poisoned first, so a reader that still sees it fails even without a sanitizer
+                    const_cast<Snapshot*>(previous)->payload.assign(PAYLOAD_SIZE, 0);
+                    delete previous;
+                });
+            }
+            domain.Reclaim();
+        }
+        return version;
+    }
+
+    // Order-sensitive digest of everything a view points at, frames included
+    u64 Digest(const AssetManager::TextureView& view) {
+        u64 hash = 1469598103934665603ull;
+        const auto mixBits = [&hash](u32 bits) {
+            hash = (hash ^ bits) * 1099511628211ull;
+        };
+        const auto mix = [&mixBits](float value) {
+            u32 bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            mixBits(bits);
+        };
+        mixBits(view.texture.id);
+        mixBits(view.generation);
+        mix(view.region.x);
+        mix(view.region.y);
+        mix(view.region.width);
+        mix(view.region.height);
+        for (const Rectangle& frame : view.framePositions) {
+            mix(frame.x);
+            mix(frame.y);
+            mix(frame.width);
+            mix(frame.height);
+        }
+        return hash;
+    }
+
+    bool ValidView(const AssetManager::TextureView& view) {
+        if (view.framePositions.size() != view.frames.count) return false;
+        const Rectangle& region = view.region;
+        for (const Rectangle& frame : view.framePositions) {
+            if (frame.width != static_cast<float>(view.gridSize.x) || frame.height != static_cast<float>(view.gridSize.y)) return false;
+            if (frame.x < region.x || frame.y < region.y ||
+                frame.x + frame.width > region.x + region.width || frame.y + frame.height > region.y + region.height) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void RunAssetReader(const std::atomic<bool>& running, ReaderStats& stats) {
+        u64 lastVersion = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            AssetManager::ReadScope scope;
+            ++stats.scopes;
+
+            const u64 version = scope.Version();
+            if (version < lastVersion) ++stats.errors;
+            lastVersion = version;
+
+            const AssetManager::TextureView* animated = scope.FindTexture(ANIMATED_TEXTURE);
+            const AssetManager::TextureView* single = scope.FindTexture(SINGLE_TEXTURE);
+            const u64 animatedDigest = animated != nullptr ? Digest(*animated) : 0;
+            const u64 singleDigest = single != nullptr ? Digest(*single) : 0;
+
+            // Keep the snapshot pinned while the writer replaces it, then check nothing moved
+            for (int pass = 0; pass < HOLD_PASSES; ++pass) {
+                if (scope.FindTexture(ANIMATED_TEXTURE) != animated || scope.FindTexture(SINGLE_TEXTURE) != single) {
+                    ++stats.errors;
+                }
+                if (animated != nullptr) {
+                    ++stats.checks;
+                    if (!ValidView(*animated) || Digest(*animated) != animatedDigest) ++stats.errors;
+                }
+                if (single != nullptr) {
+                    ++stats.checks;
+                    if (!ValidView(*single) || Digest(*single) != singleDigest) ++stats.errors;
+                }
+            }
+            if (scope.Version() != version) ++stats.errors;
+        }
+    }
+
+    // Every call below is its own write: publish, retire the previous snapshot, reclaim
+    u64 RunAssetWriter(const Clock::time_point deadline, const std::string& texture) {
+        u64 rounds = 0;
+        while (Clock::now() < deadline) {
+            AssetManager::AddSceneAnimatedTexture(ANIMATED_NAME, texture, STRESS_SCENE, FRAME_SIZE);
+            AssetManager::AddSceneTexture(SINGLE_NAME, texture, STRESS_SCENE);
+            AssetManager::RemoveSceneTextures(STRESS_SCENE);
+            ++rounds;
+        }
+        AssetManager::ReadScope scope;
+        return scope.Version();
+    }
+}
+
+int main(int argc, char** argv) {
+    int readers = 4;
+    int seconds = 5;
+    bool assets = false;
+    std::string texture = "bomber_one.png";
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--readers") == 0 && i + 1 < argc) {
+            // The main thread takes an epoch slot too
+            readers = std::clamp(std::atoi(argv[++i]), 1, static_cast<int>(EpochDomain::MAX_THREADS) - 1);
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            seconds = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--assets") == 0) {
+            assets = true;
+        } else if (std::strcmp(argv[i], "--texture") == 0 && i + 1 < argc) {
+            texture = argv[++i];
+        } else {
+            std::fprintf(stderr, "Usage: %s [--readers N] [--seconds N] [--assets] [--texture PATH]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (assets) {
+        SetTraceLogLevel(LOG_WARNING);
+        SetConfigFlags(FLAG_WINDOW_HIDDEN);
+        InitWindow(64, 64, "epoch_stress");
+        AssetManager::MountPack();
+
+        // Fail early instead of stressing an empty table
+        AssetManager::AddSceneAnimatedTexture(ANIMATED_NAME, texture, STRESS_SCENE, FRAME_SIZE);
+        const bool loaded = AssetManager::GetTexture(ANIMATED_TEXTURE).id != 0;
+        AssetManager::RemoveSceneTextures(STRESS_SCENE);
+        if (!loaded) {
+            std::fprintf(stderr, "Could not load '%s', run from a directory holding assets/ or %s\n",
+                         texture.c_str(), AssetManager::ASSET_PACK_FILE);
+            CloseWindow();
+            return 1;
+        }
+    }
+
+    std::atomic<bool> running{true};
+    std::vector<ReaderStats> stats(static_cast<size_t>(readers));
+    std::vector<std::thread> threads;
+    threads.reserve(stats.size());
+    for (auto& readerStats : stats) {
+        threads.emplace_back(assets ? RunAssetReader : RunDomainReader, std::cref(running), std::ref(readerStats));
+    }
+
+    const auto deadline = Clock::now() + std::chrono::seconds(seconds);
+    const u64 versions = assets ? RunAssetWriter(deadline, texture) : RunDomainWriter(deadline);
+
+    running.store(false, std::memory_order_relaxed);
+    for (auto& thread : threads) thread.join();
+
+    if (assets) {
+        CloseWindow();
+    } else {
+        domain.Reclaim();
+        delete published.exchange(nullptr);
+    }
+
+    std::printf("%s, %d readers, %d s, %llu snapshots published\n", assets ? "AssetManager" : "EpochDomain",
+                readers, seconds, static_cast<unsigned long long>(versions));
+    std::printf("  %6s %12s %14s %8s\n", "reader", "scopes", "checks", "errors");
+    u64 errors = 0;
+    for (size_t i = 0; i < stats.size(); ++i) {
+        std::printf("  %6zu %12llu %14llu %8llu\n", i, static_cast<unsigned long long>(stats[i].scopes),
+                    static_cast<unsigned long long>(stats[i].checks), static_cast<unsigned long long>(stats[i].errors));
+        errors += stats[i].errors;
+    }
+    return errors == 0 ? 0 : 1;
+}
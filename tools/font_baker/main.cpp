@@ -0,0 +1,160 @@
+// Bakes the glyph subsets the game actually draws into .glyphs files that AssetManager loads
+// instead of rasterizing TTFs at startup. Runs as a build step; see BAKE_FONTS in the
+// top-level CMakeLists.txt.
+//
+// Codepoints come from every string literal of the UI text header (src/UiText.h) and from every
+// file under <asset directory>/text/ (localization tables), nothing is guessed from other
+// sources. Codepoints missing from a bake render as '?'.
+//
+// Usage: font_baker <UI text header> <asset directory> <output directory> <font path>:<size>...
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "FontBake.h"
+#include "raylib.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+    // Same padding raylib's LoadFontEx uses, so baked and rasterized fonts lay out alike
+    constexpr int GLYPH_PADDING = 4;
+
+    std::string ReadFile(const fs::path& file) {
+        std::ifstream in(file, std::ios::binary);
+        std::ostringstream contents;
+        contents << in.rdbuf();
+        return contents.str();
+    }
+
+    // Appends the contents of every C++ string literal in `source` to `text`
+    void CollectLiterals(const std::string& source, std::string& text) {
+        for (size_t i = 0; i < source.size(); ++i) {
+            const char c = source[i];
+            if (c == '/' && i + 1 < source.size() && source[i + 1] == '/') {
+                i = source.find('\n', i);
+                if (i == std::string::npos) return;
+            } else if (c == '/' && i + 1 < source.size() && source[i + 1] == '*') {
+                i = source.find("*/", i + 2);
+                if (i == std::string::npos) return;
+                ++i;
+            } else if (c == '\'') {
+                // Character literal, only skipped so a '"' inside it isn't taken for a string
+                for (++i; i < source.size() && source[i] != '\''; ++i) {
+                    if (source[i] == '\\') ++i;
+                }
+            } else if (c == '"') {
+                std::string literal;
+                for (++i; i < source.size() && source[i] != '"' && source[i] != '\n'; ++i) {
+                    if (source[i] == '\\' && i + 1 < source.size()) {
+                        ++i;
+                        // Only printable escapes can become glyphs
+                        if (source[i] == '\\' || source[i] == '"' || source[i] == '\'') literal += source[i];
+                        continue;
+                    }
+                    literal += source[i];
+                }
+                text += literal;
+                // Formatted numbers are only known at runtime
+                if (literal.find('%') != std::string::npos) text += "0123456789.-+";
+            }
+        }
+    }
+
+    std::vector<int> CollectCodepoints(const fs::path& textHeader, const fs::path& assetDirectory) {
+        std::string text = " ?";    // '?' is what raylib draws for missing glyphs
+        CollectLiterals(ReadFile(textHeader), text);
+
+        std::error_code error;
+        const fs::path tables = assetDirectory / "text";
+        if (fs::is_directory(tables, error)) {
+            for (fs::recursive_directory_iterator it(tables, error), end; !error && it != end; it.increment(error)) {
+                if (it->is_regular_file()) text += ReadFile(it->path());
+            }
+        }
+
+        int count = 0;
+        int* codepoints = LoadCodepoints(text.c_str(), &count);
+        std::set<int> unique;
+        for (int i = 0; i < count; ++i) {
+            if (codepoints[i] >= 32) unique.insert(codepoints[i]);
+        }
+        UnloadCodepoints(codepoints);
+        return {unique.begin(), unique.end()};
+    }
+
+    bool BakeFont(const fs::path& assetDirectory, const fs::path& outputDirectory, const std::string& fontPath,
+                  int fontSize, std::vector<int>& codepoints) {
+        int dataSize = 0;
+        unsigned char* data = LoadFileData((assetDirectory / fontPath).string().c_str(), &dataSize);
+        if (data == nullptr) {
+            std::fprintf(stderr, "font_baker: cannot read %s\n", fontPath.c_str());
+            return false;
+        }
+
+        const int glyphCount = static_cast<int>(codepoints.size());
+        GlyphInfo* glyphs = LoadFontData(data, dataSize, fontSize, codepoints.data(), glyphCount, FONT_DEFAULT);
+        UnloadFileData(data);
+        if (glyphs == nullptr) {
+            std::fprintf(stderr, "font_baker: cannot rasterize %s\n", fontPath.c_str());
+            return false;
+        }
+
+        Rectangle* recs = nullptr;
+        Image atlas = GenImageFontAtlas(glyphs, &recs, glyphCount, fontSize, GLYPH_PADDING, 0);
+
+        const fs::path file = outputDirectory / font_bake::BakedPath(fontPath, fontSize);
+        std::error_code fsError;
+        fs::create_directories(file.parent_path(), fsError);
+
+        std::string error;
+        const bool written = font_bake::Write(file.string(), fontSize, GLYPH_PADDING, glyphs, recs, glyphCount, atlas, error);
+        if (written) {
+            std::printf("Baked %s at %dpx: %d glyphs, %dx%d atlas\n", fontPath.c_str(), fontSize, glyphCount, atlas.width, atlas.height);
+        } else {
+            std::fprintf(stderr, "font_baker: %s\n", error.c_str());
+        }
+
+        UnloadImage(atlas);
+        MemFree(recs);
+        UnloadFontData(glyphs, glyphCount);
+        return written;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 5) {
+        std::fprintf(stderr, "Usage: %s <UI text header> <asset directory> <output directory> <font path>:<size>...\n", argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    const fs::path textHeader = argv[1];
+    const fs::path assetDirectory = argv[2];
+    const fs::path outputDirectory = argv[3];
+    if (!fs::is_regular_file(textHeader)) {
+        std::fprintf(stderr, "font_baker: cannot read %s\n", textHeader.string().c_str());
+        return 1;
+    }
+    std::vector<int> codepoints = CollectCodepoints(textHeader, assetDirectory);
+
+    bool ok = true;
+    for (int i = 4; i < argc; ++i) {
+        const std::string spec = argv[i];
+        const size_t separator = spec.rfind(':');
+        const int fontSize = separator != std::string::npos ? std::atoi(spec.c_str() + separator + 1) : 0;
+        if (fontSize <= 0) {
+            std::fprintf(stderr, "font_baker: expected <font path>:<size>, got %s\n", spec.c_str());
+            ok = false;
+            continue;
+        }
+        ok &= BakeFont(assetDirectory, outputDirectory, spec.substr(0, separator), fontSize, codepoints);
+    }
+    return ok ? 0 : 1;
+}
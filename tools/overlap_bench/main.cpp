@@ -0,0 +1,82 @@
+// Times every collision::OverlapBox kernel built into this binary (scalar, SSE2, AVX2) on one
+// box against N packed SoA boxes, and checks that they all report the same hits. Box sizes
+// and density match the playfield, so roughly as many tests hit as in the game.
+//
+// Usage: overlap_bench [--queries N] [--seed N]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "Overlap.h"
+#include "GameConfig.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // Defeats dead-code elimination of the tests
+    volatile u64 sink = 0;
+}
+
+int main(int argc, char** argv) {
+    int queryCount = 20'000;
+    unsigned seed = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--queries") == 0 && i + 1 < argc) {
+            queryCount = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "Usage: %s [--queries N] [--seed N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("%d queries per size, active kernel: %s\n", queryCount, collision::GetActiveOverlapKernel().name);
+    std::printf("  %8s %8s %12s %12s\n", "targets", "kernel", "ns/query", "ns/box");
+
+    for (const size_t targetCount : {16u, 64u, 256u, 1'024u, 16'384u}) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> x(0.0f, VIRTUAL_WIDTH - ENEMY_SPRITE_SIZE);
+        std::uniform_real_distribution<float> y(0.0f, VIRTUAL_HEIGHT - ENEMY_SPRITE_SIZE);
+
+        collision::AabbSoA targets;
+        for (size_t i = 0; i < targetCount; ++i) {
+            targets.Push(Rectangle{x(rng), y(rng), ENEMY_SPRITE_SIZE, ENEMY_SPRITE_SIZE});
+        }
+        std::vector<collision::Aabb> queries;
+        for (int i = 0; i < queryCount; ++i) {
+            queries.push_back(collision::Aabb::FromRectangle(Rectangle{x(rng), y(rng), BULLET_BASE_WIDTH, BULLET_BASE_HEIGHT}));
+        }
+
+        std::vector<u32> hits(targetCount);
+        u64 expectedHits = 0;
+        bool first = true;
+        for (const auto& info : collision::GetOverlapKernels()) {
+            if (!info.supported) continue;
+
+            u64 hitCount = 0;
+            const auto start = Clock::now();
+            for (const auto& query : queries) {
+                hitCount += info.kernel(query, targets.minX.data(), targets.minY.data(), targets.maxX.data(),
+                                        targets.maxY.data(), targetCount, hits.data());
+            }
+            const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            sink = sink + hitCount;
+
+            if (first) {
+                expectedHits = hitCount;
+                first = false;
+            } else if (hitCount != expectedHits) {
+                std::fprintf(stderr, "Kernel %s found %llu hits, expected %llu\n", info.name, hitCount, expectedHits);
+                return 1;
+            }
+            std::printf("  %8zu %8s %12.1f %12.3f\n", targetCount, info.name, ns / queryCount, ns / queryCount / targetCount);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Replays frames captured with render::CaptureNextFrame (F9 in debug builds) through the
+// renderer itself, on a hidden window, so the timings cover the same render:: code the game
+// runs. Textures are replaced by same-sized placeholders, so fill cost is only approximate.
+//
+// Usage: render_replay [--iterations N] capture.rcap...
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "RenderCapture.h"
+#include "raylib.h"
+
+using namespace render::capture;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int WINDOW_WIDTH = 1280;
+    constexpr int WINDOW_HEIGHT = 720;
+
+    struct StageTimer {
+        double totalMs = 0.0;
+        double minMs = 1e30;
+        double maxMs = 0.0;
+
+        void Add(double ms) {
+            totalMs += ms;
+            minMs = std::min(minMs, ms);
+            maxMs = std::max(maxMs, ms);
+        }
+
+        template<typename Stage>
+        void Run(Stage&& stage) {
+            const auto start = Clock::now();
+            stage();
+            Add(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+
+        void Print(const char* name, int iterations) const {
+            std::printf("  %-22s avg %8.4f ms  min %8.4f ms  max %8.4f ms\n", name, totalMs / iterations, minMs, maxMs);
+        }
+    };
+
+    int ReplayFile(const std::string& file, int iterations) {
+        Frame frame;
+        StageTimer load;
+        bool loaded = false;
+        load.Run([&] { loaded = Load(file, frame); });
+        if (!loaded) {
+            std::fprintf(stderr, "%s: not a render capture\n", file.c_str());
+            return 1;
+        }
+
+        ReplayContext context;
+        LoadReplayContext(frame, context);
+
+        StageTimer submit, endDraw;
+        render::RenderStats stats;
+        for (int i = 0; i < iterations; ++i) {
+            render::BeginDraw();
+            render::Clear();
+            submit.Run([&] { Replay(frame, context); });
+            render::EndDraw();
+            stats = render::GetRenderStats();
+            endDraw.Add(stats.endDrawingMs);
+        }
+        UnloadReplayContext(context);
+
+        std::printf("%s\n", file.c_str());
+        std::printf("  %zu commands captured, %zu textures\n", frame.commands.size(), frame.textures.size());
+        std::printf("  renderer: %u draws, %u texture switches, %u state switches, %u vertices, ~%u batch flushes (estimated)\n",
+                    stats.commands, stats.textureSwitches, stats.stateSwitches, stats.vertices, stats.estimatedBatchFlushes);
+        std::printf("  draw calls if sorted by texture: %u (hypothetical, ignores overlap)\n", SortedBatchEstimate(frame));
+        load.Print("load", 1);
+        submit.Print("render:: submission", iterations);
+        endDraw.Print("EndDrawing", iterations);
+        return 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    int iterations = 1000;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        } else {
+            files.emplace_back(argv[i]);
+        }
+    }
+
+    if (files.empty()) {
+        std::fprintf(stderr, "Usage: %s [--iterations N] capture.rcap...\n", argv[0]);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "render_replay");
+    // Uncapped, otherwise EndDrawing waits out the frame time
+    SetTargetFPS(0);
+    render::Initialize();
+
+    int failures = 0;
+    for (const auto& file : files) {
+        failures += ReplayFile(file, iterations);
+    }
+
+    render::Shutdown();
+    CloseWindow();
+    return failures == 0 ? 0 : 1;
+}